@@ -372,6 +372,7 @@ struct Type<nu::AttributedText> {
            "setcolor", &nu::AttributedText::SetColor,
 #if !defined(OS_WIN)
            "setcolorfor", &SetColorFor,
+           "setattributes", &nu::AttributedText::SetAttributes,
 #endif
            "clear", &nu::AttributedText::Clear,
            "getboundsfor", &nu::AttributedText::GetBoundsFor,
@@ -495,8 +496,7 @@ struct Type<nu::Font> {
   static constexpr const char* name = "Font";
   static void BuildMetaTable(State* state, int index) {
     RawSet(state, index,
-           "create", &CreateOnHeap<nu::Font, const std::string&, float,
-                                   nu::Font::Weight, nu::Font::Style>,
+           "create", &Create,
            "createfrompath", &CreateOnHeap<nu::Font, const base::FilePath&,
                                            float>,
            "default", &nu::Font::Default,
@@ -506,6 +506,62 @@ struct Type<nu::Font> {
            "getweight", &nu::Font::GetWeight,
            "getstyle", &nu::Font::GetStyle);
   }
+  // Equal fonts are shared.
+  static nu::Font* Create(const std::string& name, float size,
+                          nu::Font::Weight weight, nu::Font::Style style) {
+    return nu::FontRegistry::GetCurrent()->Get(name, size, weight, style).get();
+  }
+};
+
+template<>
+struct Type<nu::PixelFormat> {
+  static constexpr const char* name = "PixelFormat";
+  static inline bool To(State* state, int index, nu::PixelFormat* out) {
+    std::string format;
+    if (!lua::To(state, index, &format))
+      return false;
+    if (format == "argb32") {
+      *out = nu::PixelFormat::ARGB32;
+      return true;
+    } else if (format == "argb32-premultiplied") {
+      *out = nu::PixelFormat::ARGB32Premultiplied;
+      return true;
+    } else if (format == "rgba") {
+      *out = nu::PixelFormat::RGBA;
+      return true;
+    } else {
+      return false;
+    }
+  }
+  static inline void Push(State* state, nu::PixelFormat format) {
+    switch (format) {
+      case nu::PixelFormat::ARGB32:
+        lua::Push(state, "argb32");
+        break;
+      case nu::PixelFormat::ARGB32Premultiplied:
+        lua::Push(state, "argb32-premultiplied");
+        break;
+      case nu::PixelFormat::RGBA:
+        lua::Push(state, "rgba");
+        break;
+    }
+  }
+};
+
+template<>
+struct Type<nu::Canvas::Pixels> {
+  static constexpr const char* name = "CanvasPixels";
+  static inline void Push(State* state, const nu::Canvas::Pixels& pixels) {
+    // Lua strings are immutable, so pass the memory as lightuserdata which can
+    // be accessed with FFI or native modules.
+    lua::NewTable(state);
+    lua::RawSet(state, -1,
+                "data", pixels.data.content(),
+                "length", static_cast<uint32_t>(pixels.data.size()),
+                "size", pixels.size,
+                "stride", pixels.stride,
+                "format", pixels.format);
+  }
 };
 
 template<>
@@ -517,7 +573,42 @@ struct Type<nu::Canvas> {
            "createformainscreen", &CreateOnHeap<nu::Canvas, const nu::SizeF&>,
            "getscalefactor", &nu::Canvas::GetScaleFactor,
            "getpainter", &nu::Canvas::GetPainter,
-           "getsize", &nu::Canvas::GetSize);
+           "getsize", &nu::Canvas::GetSize,
+           "lockpixels", &nu::Canvas::LockPixels,
+           "unlockpixels", &nu::Canvas::UnlockPixels,
+           "ispixelslocked", &nu::Canvas::IsPixelsLocked);
+  }
+};
+
+template<>
+struct Type<nu::Recording> {
+  static constexpr const char* name = "Recording";
+  static void BuildMetaTable(State* state, int index) {
+    RawSet(state, index,
+           "create", &CreateOnHeap<nu::Recording>,
+           "getpainter", &nu::Recording::GetPainter,
+           "clear", &nu::Recording::Clear,
+           "isempty", &nu::Recording::IsEmpty);
+  }
+};
+
+template<>
+struct Type<nu::Path> {
+  static constexpr const char* name = "Path";
+  static void BuildMetaTable(State* state, int index) {
+    RawSet(state, index,
+           "create", &CreateOnHeap<nu::Path>,
+           "moveto", &nu::Path::MoveTo,
+           "lineto", &nu::Path::LineTo,
+           "beziercurveto", &nu::Path::BezierCurveTo,
+           "arc", &nu::Path::Arc,
+           "rect", &nu::Path::Rect,
+           "closepath", &nu::Path::ClosePath,
+           "translate", &nu::Path::Translate,
+           "rotate", &nu::Path::Rotate,
+           "scale", &nu::Path::Scale,
+           "clear", &nu::Path::Clear,
+           "isempty", &nu::Path::IsEmpty);
   }
 };
 
@@ -818,12 +909,50 @@ struct Type<nu::Image> {
            "createfrombuffer", &CreateOnHeap<nu::Image,
                                              const nu::Buffer&,
                                              float>,
+           "createthumbnailfrompath",
+           &CreateOnHeap<nu::Image, const base::FilePath&, const nu::SizeF&>,
+           "createfrompixels",
+           &CreateOnHeap<nu::Image, const nu::Buffer&, const nu::Size&, int,
+                         nu::PixelFormat, float>,
+           "createfrompathasync", &nu::Image::CreateFromPathAsync,
+           "createfrombufferasync", &nu::Image::CreateFromBufferAsync,
            "isempty", &nu::Image::IsEmpty,
            "getsize", &nu::Image::GetSize,
            "getscalefactor", &nu::Image::GetScaleFactor);
   }
 };
 
+template<>
+struct Type<nu::ImageCache> {
+  static constexpr const char* name = "ImageCache";
+  static void BuildMetaTable(State* state, int metatable) {
+    RawSet(state, metatable,
+           "getfrompath", &nu::ImageCache::GetFromPath,
+           "getthumbnailfrompath", &nu::ImageCache::GetThumbnailFromPath,
+           "getfrombuffer", &nu::ImageCache::GetFromBuffer,
+           "setmemorybudget", &nu::ImageCache::SetMemoryBudget,
+           "getmemorybudget", &nu::ImageCache::GetMemoryBudget,
+           "getmemoryusage", &nu::ImageCache::GetMemoryUsage,
+           "gethitcount", &nu::ImageCache::GetHitCount,
+           "getmisscount", &nu::ImageCache::GetMissCount,
+           "clear", &nu::ImageCache::Clear);
+  }
+};
+
+template<>
+struct Type<nu::TextLayoutCache> {
+  static constexpr const char* name = "TextLayoutCache";
+  static void BuildMetaTable(State* state, int metatable) {
+    RawSet(state, metatable,
+           "setcapacity", &nu::TextLayoutCache::SetCapacity,
+           "getcapacity", &nu::TextLayoutCache::GetCapacity,
+           "getcount", &nu::TextLayoutCache::GetCount,
+           "gethitcount", &nu::TextLayoutCache::GetHitCount,
+           "getmisscount", &nu::TextLayoutCache::GetMissCount,
+           "clear", &nu::TextLayoutCache::Clear);
+  }
+};
+
 template<>
 struct Type<nu::TextAlign> {
   static constexpr const char* name = "TextAlign";
@@ -891,6 +1020,39 @@ struct Type<nu::TextAttributes> {
   }
 };
 
+template<>
+struct Type<nu::AttributedText::Range> {
+  static constexpr const char* name = "AttributedTextRange";
+  static inline bool To(State* state, int index,
+                        nu::AttributedText::Range* out) {
+    if (GetType(state, index) != LuaType::Table)
+      return false;
+    int start = 1, end = -1;
+    RawGetAndPop(state, index, "start", &start);
+    RawGetAndPop(state, index, "end", &end);
+    out->start = start - 1;
+    out->end = end <= 0 ? end : end - 1;
+    nu::Font* font;
+    if (RawGetAndPop(state, index, "font", &font))
+      out->font = font;
+    nu::Color color;
+    if (RawGetAndPop(state, index, "color", &color))
+      out->color = color;
+    return true;
+  }
+};
+
+template<>
+struct Type<nu::TextMeasurer> {
+  static constexpr const char* name = "TextMeasurer";
+  static void BuildMetaTable(State* state, int metatable) {
+    RawSet(state, metatable,
+           "create", &CreateOnHeap<nu::TextMeasurer, nu::TextAttributes>,
+           "measure", &nu::TextMeasurer::Measure,
+           "measureoneline", &nu::TextMeasurer::MeasureOneLine);
+  }
+};
+
 template<>
 struct Type<nu::Painter> {
   static constexpr const char* name = "Painter";
@@ -916,15 +1078,39 @@ struct Type<nu::Painter> {
            "setlinewidth", &nu::Painter::SetLineWidth,
            "stroke", &nu::Painter::Stroke,
            "fill", &nu::Painter::Fill,
+           "strokepath", &nu::Painter::StrokePath,
+           "fillpath", &nu::Painter::FillPath,
            "clear", &nu::Painter::Clear,
            "strokerect", &nu::Painter::StrokeRect,
            "fillrect", &nu::Painter::FillRect,
+           "fillrects", &FillRects,
+           "strokerects", &StrokeRects,
+           "drawpolyline", &DrawPolyline,
+           "drawpoints", &DrawPoints,
+           "fillcircles", &FillCircles,
            "drawimage", &nu::Painter::DrawImage,
            "drawimagefromrect", &nu::Painter::DrawImageFromRect,
            "drawcanvas", &nu::Painter::DrawCanvas,
            "drawcanvasfromrect", &nu::Painter::DrawCanvasFromRect,
            "drawattributedtext", &nu::Painter::DrawAttributedText,
-           "drawtext", &nu::Painter::DrawText);
+           "drawtext", &nu::Painter::DrawText,
+           "drawrecording", &nu::Painter::DrawRecording);
+  }
+  static void FillRects(nu::Painter* painter, const nu::Buffer& rects) {
+    painter->FillRects(rects.content(), rects.size());
+  }
+  static void StrokeRects(nu::Painter* painter, const nu::Buffer& rects) {
+    painter->StrokeRects(rects.content(), rects.size());
+  }
+  static void DrawPolyline(nu::Painter* painter, const nu::Buffer& points) {
+    painter->DrawPolyline(points.content(), points.size());
+  }
+  static void DrawPoints(nu::Painter* painter, const nu::Buffer& points,
+                         float size) {
+    painter->DrawPoints(points.content(), points.size(), size);
+  }
+  static void FillCircles(nu::Painter* painter, const nu::Buffer& circles) {
+    painter->FillCircles(circles.content(), circles.size());
   }
 };
 
@@ -996,7 +1182,8 @@ struct Type<nu::MouseEvent> {
     RawSet(state, -1,
            "button", event.button,
            "positioninview", event.position_in_view,
-           "positioninwindow", event.position_in_window);
+           "positioninwindow", event.position_in_window,
+           "history", event.history);
   }
 };
 
@@ -1563,6 +1750,8 @@ struct Type<nu::View> {
            "hascapture", &nu::View::HasCapture,
            "setmousedowncanmovewindow", &nu::View::SetMouseDownCanMoveWindow,
            "ismousedowncanmovewindow", &nu::View::IsMouseDownCanMoveWindow,
+           "setmousemovecoalescing", &nu::View::SetMouseMoveCoalescing,
+           "ismousemovecoalescing", &nu::View::IsMouseMoveCoalescing,
            "dodrag", &nu::View::DoDrag,
            "dodragwithoptions", &nu::View::DoDragWithOptions,
            "canceldrag", &nu::View::CancelDrag,
@@ -1603,6 +1792,30 @@ struct Type<nu::View> {
     view->Layout();
   }
 };
+
+template<>
+struct Type<nu::StyleSheet> {
+  static constexpr const char* name = "StyleSheet";
+  static void BuildMetaTable(State* state, int metatable) {
+    RawSet(state, metatable,
+           "create", &Create,
+           "setstyle", &SetStyle,
+           "applyto", &nu::StyleSheet::ApplyTo,
+           "applytoviews", &nu::StyleSheet::ApplyToViews);
+  }
+  static nu::StyleSheet* Create(
+      const std::map<std::string, std::string>& styles) {
+    nu::StyleSheet* sheet = new nu::StyleSheet;
+    SetStyle(sheet, styles);
+    return sheet;
+  }
+  static void SetStyle(nu::StyleSheet* sheet,
+                       const std::map<std::string, std::string>& styles) {
+    for (const auto& it : styles)
+      sheet->SetStyleProperty(it.first, it.second);
+  }
+};
+
 template<>
 struct Type<nu::ComboBox> {
   using base = nu::Picker;
@@ -1635,6 +1848,11 @@ struct Type<nu::Container> {
            RefMethod(&AddChildViewAt, RefType::Ref),
            "removechildview",
            RefMethod(&nu::Container::RemoveChildView, RefType::Deref),
+           "beginupdate", &nu::Container::BeginUpdate,
+           "endupdate", &nu::Container::EndUpdate,
+           "isupdating", &nu::Container::IsUpdating,
+           "setasynclayout", &nu::Container::SetAsyncLayout,
+           "isasynclayout", &nu::Container::IsAsyncLayout,
            "childcount", &nu::Container::ChildCount,
            "childat", &ChildAt);
     RawSetProperty(state, index, "ondraw", &nu::Container::on_draw);
@@ -1939,7 +2157,7 @@ struct Type<nu::Label> {
            "setvalign", &nu::Label::SetVAlign,
            "setattributedtext",
            RefMethod(&nu::Label::SetAttributedText, RefType::Reset, "atext"),
-           "getattributedtext", &nu::Label::GetAttributedText);
+           "getattributedtext", &nu::Label::GetMutableAttributedText);
   }
 };
 
@@ -2428,7 +2646,12 @@ extern "C" int luaopen_yue_gui(lua::State* state) {
   BindType<nu::Cursor>(state, "Cursor");
   BindType<nu::DraggingInfo>(state, "DraggingInfo");
   BindType<nu::Image>(state, "Image");
+  BindType<nu::ImageCache>(state, "ImageCache");
+  BindType<nu::TextLayoutCache>(state, "TextLayoutCache");
+  BindType<nu::TextMeasurer>(state, "TextMeasurer");
   BindType<nu::Painter>(state, "Painter");
+  BindType<nu::Recording>(state, "Recording");
+  BindType<nu::Path>(state, "Path");
   BindType<nu::Event>(state, "Event");
   BindType<nu::FileDialog>(state, "FileDialog");
   BindType<nu::FileOpenDialog>(state, "FileOpenDialog");
@@ -2440,6 +2663,7 @@ extern "C" int luaopen_yue_gui(lua::State* state) {
   BindType<nu::Window>(state, "Window");
   BindType<nu::ComboBox>(state, "ComboBox");
   BindType<nu::Container>(state, "Container");
+  BindType<nu::StyleSheet>(state, "StyleSheet");
   BindType<nu::Button>(state, "Button");
   BindType<nu::ProtocolStringJob>(state, "ProtocolStringJob");
   BindType<nu::ProtocolFileJob>(state, "ProtocolFileJob");
@@ -2468,9 +2692,11 @@ extern "C" int luaopen_yue_gui(lua::State* state) {
 #endif
   // Properties.
   lua::RawSet(state, -1,
-              "lifetime",   nu::Lifetime::GetCurrent(),
-              "app",        nu::App::GetCurrent(),
-              "appearance", nu::Appearance::GetCurrent(),
-              "screen",     nu::Screen::GetCurrent());
+              "lifetime",        nu::Lifetime::GetCurrent(),
+              "app",             nu::App::GetCurrent(),
+              "appearance",      nu::Appearance::GetCurrent(),
+              "imagecache",      nu::ImageCache::GetCurrent(),
+              "textlayoutcache", nu::TextLayoutCache::GetCurrent(),
+              "screen",          nu::Screen::GetCurrent());
   return 1;
 }
@@ -9,6 +9,11 @@
 #include <utility>
 
 #include "base/logging.h"
+#include "nativeui/message_loop.h"
+#include "nativeui/state.h"
+#include "nativeui/util/layout_snapshot.h"
+#include "nativeui/util/worker_pool.h"
+#include "nativeui/util/yoga_util.h"
 #include "third_party/yoga/Yoga.h"
 
 namespace nu {
@@ -20,22 +25,65 @@ inline bool IsRootYGNode(Container* view) {
   return !YGNodeGetParent(view->node()) || !view->IsContainer();
 }
 
+// Whether the layout of a Container is computed asynchronously by its root.
+bool IsInAsyncLayout(Container* view) {
+  while (!IsRootYGNode(view))
+    view = static_cast<Container*>(view->GetParent());
+  return view->IsAsyncLayout();
+}
+
 // Get bounds from the CSS node.
 inline RectF GetYGNodeBounds(YGNodeRef node) {
   return RectF(YGNodeLayoutGetLeft(node), YGNodeLayoutGetTop(node),
                YGNodeLayoutGetWidth(node), YGNodeLayoutGetHeight(node));
 }
 
+// Create a copy of the node tree, which can be used for measurement without
+// touching the layout of the original tree.
+YGNodeRef CloneYGNodeTree(YGNodeRef node) {
+  YGNodeRef clone = YGNodeClone(node);
+  YGNodeSetDirtiedFunc(clone, nullptr);
+  uint32_t count = YGNodeGetChildCount(node);
+  if (count == 0)
+    return clone;
+  // The clone shares children with original node, replace them with copies.
+  YGNodeRemoveAllChildren(clone);
+  for (uint32_t i = 0; i < count; ++i)
+    YGNodeInsertChild(clone, CloneYGNodeTree(YGNodeGetChild(node, i)), i);
+  return clone;
+}
+
+// Max number of cached measurements.
+const size_t kMaxMeasureCacheSize = 8;
+
+// Max number of times to compute a snapshot before giving up, each pass
+// measures the views that were missing in last pass.
+const int kMaxAsyncLayoutPasses = 4;
+
+// Compute the snapshot on a background thread and report back to the root.
+void PostLayoutSnapshot(scoped_refptr<LayoutSnapshot> snapshot) {
+  State::GetCurrent()->GetWorkerPool()->PostTask(
+      [snapshot = std::move(snapshot)]() mutable {
+    bool complete = snapshot->Compute();
+    // Hand over the reference so the snapshot is released on UI thread.
+    MessageLoop::PostTask([snapshot = std::move(snapshot), complete]() {
+      snapshot->root()->OnAsyncLayoutDone(snapshot.get(), complete);
+    });
+  });
+}
+
 }  // namespace
 
 // static
 const char Container::kClassName[] = "Container";
 
 Container::Container() {
+  YGNodeSetDirtiedFunc(node(), &Container::OnNodeDirtied);
   PlatformInit();
 }
 
 Container::Container(const char* an_empty_constructor) {
+  YGNodeSetDirtiedFunc(node(), &Container::OnNodeDirtied);
 }
 
 Container::~Container() {
@@ -47,10 +95,27 @@ const char* Container::GetClassName() const {
 }
 
 void Container::Layout() {
+  // Defer the layout until the batch update is done.
+  Container* updating = GetUpdatingContainer();
+  if (updating) {
+    // Mark containers on the way so they refresh children even when their
+    // own sizes do not change.
+    for (Container* c = this; c != updating;
+         c = static_cast<Container*>(c->GetParent()))
+      c->dirty_ = true;
+    updating->dirty_ = true;
+    updating->needs_layout_ = true;
+    return;
+  }
+
   // For child CSS node, tell parent to do the layout.
   if (!IsRootYGNode(this)) {
     dirty_ = true;
     static_cast<Container*>(GetParent())->Layout();
+    // The CSS nodes are not calculated with async layout, keep dirty_ set and
+    // wait for the frames to be applied by the snapshot.
+    if (IsInAsyncLayout(this))
+      return;
     // The parent may choose to not update this view because its size is not
     // changed, in that case we need to force updating here.
     // This usually happens after adding a child view, since the container does
@@ -62,9 +127,14 @@ void Container::Layout() {
   }
 
   // So this is a root CSS node, calculate the layout and set bounds.
-  SizeF size(GetBounds().size());
-  YGNodeCalculateLayout(node(), size.width(), size.height(), YGDirectionLTR);
-  SetChildBoundsFromCSS();
+  if (async_layout_) {
+    ++layout_generation_;
+    // An in-flight snapshot will notice it is stale and start a new one.
+    if (!layout_snapshot_)
+      StartAsyncLayout();
+    return;
+  }
+  CalculateLayout();
 }
 
 bool Container::IsContainer() const {
@@ -75,26 +145,23 @@ void Container::OnSizeChanged() {
   View::OnSizeChanged();
   if (IsRootYGNode(this))
     Layout();
-  else
+  else if (!IsInAsyncLayout(this))
     SetChildBoundsFromCSS();
 }
 
 SizeF Container::GetPreferredSize() const {
   float nan = std::numeric_limits<float>::quiet_NaN();
-  YGNodeCalculateLayout(node(), nan, nan, YGDirectionLTR);
-  return SizeF(YGNodeLayoutGetWidth(node()), YGNodeLayoutGetHeight(node()));
+  return Measure(nan, nan);
 }
 
 float Container::GetPreferredHeightForWidth(float width) const {
   float nan = std::numeric_limits<float>::quiet_NaN();
-  YGNodeCalculateLayout(node(), width, nan, YGDirectionLTR);
-  return YGNodeLayoutGetHeight(node());
+  return Measure(width, nan).height();
 }
 
 float Container::GetPreferredWidthForHeight(float height) const {
   float nan = std::numeric_limits<float>::quiet_NaN();
-  YGNodeCalculateLayout(node(), nan, height, YGDirectionLTR);
-  return YGNodeLayoutGetWidth(node());
+  return Measure(nan, height).width();
 }
 
 void Container::AddChildView(scoped_refptr<View> view) {
@@ -141,15 +208,149 @@ void Container::RemoveChildView(View* view) {
   Layout();
 }
 
+void Container::BeginUpdate() {
+  ++update_count_;
+}
+
+void Container::EndUpdate() {
+  DCHECK_GT(update_count_, 0);
+  if (update_count_ == 0 || --update_count_ > 0)
+    return;
+  if (needs_layout_) {
+    needs_layout_ = false;
+    Layout();
+  }
+}
+
+void Container::SetAsyncLayout(bool async) {
+  if (async_layout_ == async)
+    return;
+  async_layout_ = async;
+  if (!async) {
+    // Discard the in-flight snapshot and compute synchronously.
+    ++layout_generation_;
+    Layout();
+  }
+}
+
 void Container::SetChildBoundsFromCSS() {
+  UpdateChildBounds(true);
+}
+
+void Container::ApplyAsyncLayout() {
+  dirty_ = false;
+  if (!IsVisible())
+    return;
+  for (int i = 0; i < ChildCount(); ++i) {
+    View* child = ChildAt(i);
+    RectF bounds = GetYGNodeBounds(child->node());
+    if (child->IsVisible() && bounds != child->GetBounds())
+      child->SetBounds(bounds);
+  }
+}
+
+void Container::OnAsyncLayoutDone(LayoutSnapshot* snapshot, bool complete) {
+  DCHECK_EQ(snapshot, layout_snapshot_.get());
+  layout_snapshot_ = nullptr;
+  if (!async_layout_ || !IsRootYGNode(this))
+    return;
+  // The tree has changed since the snapshot was taken.
+  if (snapshot->generation() != layout_generation_) {
+    StartAsyncLayout();
+    return;
+  }
+  if (!complete) {
+    // Views can only be measured on UI thread, do it and try again.
+    if (snapshot->passes() < kMaxAsyncLayoutPasses) {
+      layout_snapshot_ = snapshot;
+      snapshot->MeasureMissing();
+      PostLayoutSnapshot(layout_snapshot_);
+    } else {
+      CalculateLayout();
+    }
+    return;
+  }
+  snapshot->Apply();
+}
+
+void Container::UpdateChildBounds(bool force) {
   dirty_ = false;
   if (!IsVisible())
     return;
   for (int i = 0; i < ChildCount(); ++i) {
     View* child = ChildAt(i);
-    if (child->IsVisible())
-      child->SetBounds(GetYGNodeBounds(child->node()));
+    // Yoga only marks the nodes it has visited in last layout, nodes without
+    // new layout have the same frames and so do their descendants.
+    bool has_new_layout = YGNodeGetHasNewLayout(child->node());
+    YGNodeSetHasNewLayout(child->node(), false);
+    if (!child->IsVisible())
+      continue;
+    if (force || has_new_layout) {
+      RectF bounds = GetYGNodeBounds(child->node());
+      if (force || bounds != child->GetBounds())
+        child->SetBounds(bounds);
+    }
+    // The size of child container may not change while its children have new
+    // layout, and children changed during a batch update need refreshing too.
+    if (child->IsContainer()) {
+      Container* c = static_cast<Container*>(child);
+      if (has_new_layout || c->dirty_)
+        c->UpdateChildBounds(c->dirty_);
+    }
+  }
+}
+
+SizeF Container::Measure(float width, float height) const {
+  // A clean node is guaranteed to get notified when its tree changes, so the
+  // cached results can be trusted.
+  bool cacheable = !YGNodeIsDirty(node());
+  if (cacheable) {
+    for (const auto& entry : measure_cache_) {
+      if (ConstraintEquals(entry.width, width) &&
+          ConstraintEquals(entry.height, height))
+        return entry.size;
+    }
   }
+
+  // Compute on a copy of the tree to keep the committed layout.
+  YGNodeRef clone = CloneYGNodeTree(node());
+  CalculateYogaLayout(clone, width, height);
+  SizeF size(YGNodeLayoutGetWidth(clone), YGNodeLayoutGetHeight(clone));
+  YGNodeFreeRecursive(clone);
+
+  if (cacheable) {
+    if (measure_cache_.size() >= kMaxMeasureCacheSize)
+      measure_cache_.erase(measure_cache_.begin());
+    measure_cache_.push_back({width, height, size});
+  }
+  return size;
+}
+
+// static
+void Container::OnNodeDirtied(YGNodeRef node) {
+  View* view = static_cast<View*>(YGNodeGetContext(node));
+  static_cast<Container*>(view)->measure_cache_.clear();
+}
+
+Container* Container::GetUpdatingContainer() {
+  for (View* v = this; v && v->IsContainer(); v = v->GetParent()) {
+    Container* c = static_cast<Container*>(v);
+    if (c->IsUpdating())
+      return c;
+  }
+  return nullptr;
+}
+
+void Container::CalculateLayout() {
+  SizeF size(GetBounds().size());
+  CalculateYogaLayout(node(), size.width(), size.height());
+  YGNodeSetHasNewLayout(node(), false);
+  UpdateChildBounds(false);
+}
+
+void Container::StartAsyncLayout() {
+  layout_snapshot_ = new LayoutSnapshot(this, layout_generation_);
+  PostLayoutSnapshot(layout_snapshot_);
 }
 
 }  // namespace nu
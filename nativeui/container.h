@@ -11,6 +11,7 @@
 
 namespace nu {
 
+class LayoutSnapshot;
 class Painter;
 
 class NATIVEUI_EXPORT Container : public View {
@@ -38,6 +39,17 @@ class NATIVEUI_EXPORT Container : public View {
   void AddChildViewAt(scoped_refptr<View> view, int index);
   void RemoveChildView(View* view);
 
+  // Defer layout of this container and its descendants until the matching
+  // EndUpdate call, calls can be nested.
+  void BeginUpdate();
+  void EndUpdate();
+  bool IsUpdating() const { return update_count_ > 0; }
+
+  // Compute the layout on a background thread, only works for root container.
+  // The bounds of children are updated asynchronously when enabled.
+  void SetAsyncLayout(bool async);
+  bool IsAsyncLayout() const { return async_layout_; }
+
   // Get children.
   int ChildCount() const { return static_cast<int>(children_.size()); }
   View* ChildAt(int index) const {
@@ -49,6 +61,13 @@ class NATIVEUI_EXPORT Container : public View {
   // Internal: Used by certain implementations to refresh layout.
   void SetChildBoundsFromCSS();
 
+  // Internal: Set bounds of children after the layout computed asynchronously
+  // has been copied to the CSS nodes.
+  void ApplyAsyncLayout();
+
+  // Internal: Called when the layout snapshot has been computed.
+  void OnAsyncLayoutDone(LayoutSnapshot* snapshot, bool complete);
+
   // Events.
   Signal<void(Container*, Painter*, const RectF&)> on_draw;
 
@@ -64,11 +83,55 @@ class NATIVEUI_EXPORT Container : public View {
   void PlatformRemoveChildView(View* view);
 
  private:
+  // Cached result of measurement under constraints.
+  struct MeasureCacheEntry {
+    float width;
+    float height;
+    SizeF size;
+  };
+
+  // Compute the size of children under the constraints, NaN means undefined.
+  SizeF Measure(float width, float height) const;
+
+  // Called by yoga when the node or its descendants become dirty.
+  static void OnNodeDirtied(YGNodeRef node);
+
+  // Set bounds of children from the CSS nodes, when |force| is false only the
+  // children with new layout are updated.
+  void UpdateChildBounds(bool force);
+
+  // Find the container that is deferring layout for this view.
+  Container* GetUpdatingContainer();
+
+  // Compute the layout of root node on UI thread.
+  void CalculateLayout();
+
+  // Take a snapshot of the tree and compute it on a background thread.
+  void StartAsyncLayout();
+
   // Relationships.
   std::vector<scoped_refptr<View>> children_;
 
   // Whether the container should update children's layout.
   bool dirty_ = false;
+
+  // Number of pending BeginUpdate calls.
+  int update_count_ = 0;
+
+  // Whether a layout was requested while updating.
+  bool needs_layout_ = false;
+
+  // Results of preferred size measurements, cleared when the tree changes.
+  mutable std::vector<MeasureCacheEntry> measure_cache_;
+
+  // Whether to compute layout on a background thread.
+  bool async_layout_ = false;
+
+  // Increased on every layout request, used to detect stale snapshots.
+  int layout_generation_ = 0;
+
+  // The snapshot being computed.
+  scoped_refptr<LayoutSnapshot> layout_snapshot_;
 };
 
 }  // namespace nu
@@ -0,0 +1,76 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <string>
+
+#include "nativeui/nativeui.h"
+#include "nativeui/test/perf_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class ContainerPerfTest : public testing::Test {
+ protected:
+  using BuildTree = void(*)(nu::Container*, int);
+
+  void SetUp() override {
+    window_ = new nu::Window(nu::Window::Options());
+    window_->SetContentSize(nu::SizeF(800, 600));
+  }
+
+  // Time building the tree, relayout, and a bounded number of mutations on
+  // the built tree.
+  void RunTreeTest(const std::string& name, BuildTree build) {
+    for (int views : nu::kPerfTreeSizes) {
+      scoped_refptr<nu::Container> root = new nu::Container;
+      window_->SetContentView(root.get());
+
+      nu::PerfTimer build_timer;
+      build(root.get(), views);
+      nu::PrintPerfResult(name + ".Build", views, build_timer.Elapsed());
+
+      nu::PerfTimer layout_timer;
+      root->Layout();
+      nu::PrintPerfResult(name + ".Layout", views, layout_timer.Elapsed());
+
+      nu::PerfTimer add_timer;
+      for (int i = 0; i < nu::kPerfMutations; ++i)
+        root->AddChildView(new nu::Label("Label"));
+      nu::PrintPerfResult(name + ".AddChildView", views, add_timer.Elapsed());
+
+      nu::PerfTimer remove_timer;
+      for (int i = 0; i < nu::kPerfMutations; ++i)
+        root->RemoveChildView(root->ChildAt(root->ChildCount() - 1));
+      nu::PrintPerfResult(name + ".RemoveChildView", views,
+                          remove_timer.Elapsed());
+    }
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  scoped_refptr<nu::Window> window_;
+};
+
+TEST_F(ContainerPerfTest, WideTree) {
+  RunTreeTest("WideTree", &nu::BuildWideTree);
+}
+
+TEST_F(ContainerPerfTest, DeepTree) {
+  RunTreeTest("DeepTree", &nu::BuildDeepTree);
+}
+
+TEST_F(ContainerPerfTest, MixedTree) {
+  RunTreeTest("MixedTree", &nu::BuildMixedTree);
+}
+
+TEST_F(ContainerPerfTest, GetPreferredSize) {
+  for (int views : nu::kPerfTreeSizes) {
+    scoped_refptr<nu::Container> root = new nu::Container;
+    window_->SetContentView(root.get());
+    nu::BuildMixedTree(root.get(), views);
+
+    nu::PerfTimer timer;
+    for (int i = 0; i < 10; ++i)
+      root->GetPreferredSize();
+    nu::PrintPerfResult("MixedTree.GetPreferredSize", views, timer.Elapsed());
+  }
+}
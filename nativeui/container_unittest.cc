@@ -4,6 +4,11 @@
 
 #include "nativeui/nativeui.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/yoga/Yoga.h"
+
+#if defined(OS_LINUX)
+#include <gtk/gtk.h>
+#endif
 
 class TestContainer : public nu::Container {
  public:
@@ -14,12 +19,19 @@ class TestContainer : public nu::Container {
     ++layout_count_;
   }
 
+  void OnSizeChanged() override {
+    nu::Container::OnSizeChanged();
+    ++size_changed_count_;
+  }
+
   int layout_count() const { return layout_count_; }
+  int size_changed_count() const { return size_changed_count_; }
 
  private:
   ~TestContainer() override {}
 
   int layout_count_ = 0;
+  int size_changed_count_ = 0;
 };
 
 class ContainerTest : public testing::Test {
@@ -88,6 +100,224 @@ TEST_F(ContainerTest, Layout) {
   EXPECT_EQ(container_->layout_count(), 3);
 }
 
+TEST_F(ContainerTest, BatchUpdate) {
+  window_->SetContentSize(nu::SizeF(200, 400));
+  container_->BeginUpdate();
+  EXPECT_TRUE(container_->IsUpdating());
+  nu::Container* c = new nu::Container;
+  c->SetStyle("flex", 1);
+  container_->AddChildView(c);
+  scoped_refptr<nu::Container> v = new nu::Container;
+  v->SetStyle("flex", 1);
+  c->AddChildView(v.get());
+  EXPECT_EQ(v->GetBounds(), nu::RectF());
+  container_->EndUpdate();
+  EXPECT_FALSE(container_->IsUpdating());
+  EXPECT_EQ(c->GetBounds(), nu::RectF(0, 0, 200, 400));
+  EXPECT_EQ(v->GetBounds(), nu::RectF(0, 0, 200, 400));
+}
+
+TEST_F(ContainerTest, NestedBatchUpdate) {
+  window_->SetContentSize(nu::SizeF(200, 400));
+  nu::Container* c = new nu::Container;
+  c->SetStyle("flex", 1);
+  container_->AddChildView(c);
+  container_->BeginUpdate();
+  c->BeginUpdate();
+  scoped_refptr<nu::Container> v = new nu::Container;
+  v->SetStyle("flex", 1);
+  c->AddChildView(v.get());
+  c->EndUpdate();
+  EXPECT_EQ(v->GetBounds(), nu::RectF());
+  container_->EndUpdate();
+  EXPECT_EQ(v->GetBounds(), nu::RectF(0, 0, 200, 400));
+}
+
+TEST_F(ContainerTest, IncrementalLayout) {
+  window_->SetContentSize(nu::SizeF(200, 400));
+  scoped_refptr<TestContainer> c1 = new TestContainer;
+  c1->SetStyle("height", 100);
+  container_->AddChildView(c1.get());
+  scoped_refptr<TestContainer> c1_child = new TestContainer;
+  c1_child->SetStyle("flex", 1);
+  c1->AddChildView(c1_child.get());
+  nu::Container* c2 = new nu::Container;
+  c2->SetStyle("flex", 1);
+  container_->AddChildView(c2);
+  nu::Container* c3 = new nu::Container;
+  c3->SetStyle("flex", 1);
+  c2->AddChildView(c3);
+  EXPECT_EQ(c3->GetBounds(), nu::RectF(0, 0, 200, 300));
+  // Changing a deep child should not break layout of other children.
+  scoped_refptr<TestContainer> sibling = new TestContainer;
+  sibling->SetStyle("height", 20);
+  c3->AddChildView(sibling.get());
+  scoped_refptr<nu::Container> v = new nu::Container;
+  v->SetStyle("height", 50);
+  c3->AddChildView(v.get());
+  EXPECT_EQ(c1->GetBounds(), nu::RectF(0, 0, 200, 100));
+  EXPECT_EQ(c2->GetBounds(), nu::RectF(0, 100, 200, 300));
+  EXPECT_EQ(sibling->GetBounds(), nu::RectF(0, 0, 200, 20));
+  EXPECT_EQ(v->GetBounds(), nu::RectF(0, 20, 200, 50));
+  int c1_layouts = c1->layout_count();
+  int c1_size_changes = c1->size_changed_count();
+  int c1_child_size_changes = c1_child->size_changed_count();
+  int sibling_size_changes = sibling->size_changed_count();
+  v->SetStyle("height", 80);
+  EXPECT_EQ(v->GetBounds(), nu::RectF(0, 20, 200, 80));
+  // Views not affected by the change are not touched.
+  EXPECT_EQ(c1->layout_count(), c1_layouts);
+  EXPECT_EQ(c1->size_changed_count(), c1_size_changes);
+  EXPECT_EQ(c1_child->size_changed_count(), c1_child_size_changes);
+  EXPECT_EQ(sibling->size_changed_count(), sibling_size_changes);
+  EXPECT_EQ(c1->GetBounds(), nu::RectF(0, 0, 200, 100));
+  EXPECT_EQ(sibling->GetBounds(), nu::RectF(0, 0, 200, 20));
+}
+
+#if defined(OS_LINUX)
+void CountAllocation(GtkWidget*, GdkRectangle*, int* count) {
+  ++*count;
+}
+
+TEST_F(ContainerTest, ResizeDoesNotReallocateCleanSubtrees) {
+  window_->SetContentSize(nu::SizeF(200, 400));
+  nu::Container* c1 = new nu::Container;
+  c1->SetStyle("width", 100, "height", 100);
+  container_->AddChildView(c1);
+  nu::Container* c1_child = new nu::Container;
+  c1_child->SetStyle("flex", 1);
+  c1->AddChildView(c1_child);
+  nu::Container* c2 = new nu::Container;
+  c2->SetStyle("flex", 1);
+  container_->AddChildView(c2);
+  int c1_allocations = 0;
+  int c1_child_allocations = 0;
+  g_signal_connect(c1->GetNative(), "size-allocate",
+                   G_CALLBACK(CountAllocation), &c1_allocations);
+  g_signal_connect(c1_child->GetNative(), "size-allocate",
+                   G_CALLBACK(CountAllocation), &c1_child_allocations);
+  window_->SetContentSize(nu::SizeF(300, 500));
+  EXPECT_EQ(c2->GetBounds(), nu::RectF(0, 100, 300, 400));
+  EXPECT_EQ(c1->GetBounds(), nu::RectF(0, 0, 100, 100));
+  EXPECT_EQ(c1_child->GetBounds(), nu::RectF(0, 0, 100, 100));
+  EXPECT_EQ(c1_allocations, 0);
+  EXPECT_EQ(c1_child_allocations, 0);
+}
+#endif
+
+TEST_F(ContainerTest, PreferredSizeKeepsLayout) {
+  window_->SetContentSize(nu::SizeF(200, 400));
+  nu::Container* c = new nu::Container;
+  c->SetStyle("flex", 1, "min-width", 50, "min-height", 60);
+  container_->AddChildView(c);
+  EXPECT_EQ(container_->GetPreferredSize(), nu::SizeF(50, 60));
+  container_->SetChildBoundsFromCSS();
+  EXPECT_EQ(c->GetBounds(), nu::RectF(0, 0, 200, 400));
+}
+
+TEST_F(ContainerTest, PreferredSizeCache) {
+  window_->SetContentSize(nu::SizeF(200, 400));
+  nu::Container* c = new nu::Container;
+  c->SetStyle("width", 50, "height", 60);
+  container_->AddChildView(c);
+  EXPECT_EQ(container_->GetPreferredSize(), nu::SizeF(50, 60));
+  EXPECT_EQ(container_->GetPreferredSize(), nu::SizeF(50, 60));
+  EXPECT_EQ(container_->GetPreferredHeightForWidth(100), 60);
+  c->SetStyle("height", 80);
+  EXPECT_EQ(container_->GetPreferredSize(), nu::SizeF(50, 80));
+  EXPECT_EQ(container_->GetPreferredHeightForWidth(100), 80);
+}
+
+TEST_F(ContainerTest, AsyncLayout) {
+  window_->SetContentSize(nu::SizeF(200, 400));
+  container_->SetAsyncLayout(true);
+  scoped_refptr<nu::Container> c = new nu::Container;
+  c->SetStyle("width", 50, "height", 60);
+  scoped_refptr<nu::Label> label = new nu::Label("label");
+  container_->AddChildView(c);
+  container_->AddChildView(label);
+  // Wait until the layout computed in background has been applied.
+  std::function<void()> check = [&]() {
+    if (label->GetBounds().height() > 0)
+      nu::MessageLoop::Quit();
+    else
+      nu::MessageLoop::PostDelayedTask(10, check);
+  };
+  nu::MessageLoop::PostTask(check);
+  nu::MessageLoop::Run();
+  EXPECT_EQ(c->GetBounds(), nu::RectF(0, 0, 50, 60));
+  EXPECT_EQ(label->GetBounds().y(), 60);
+  EXPECT_EQ(label->GetBounds().width(), 200);
+}
+
+TEST_F(ContainerTest, AsyncLayoutReplaceChild) {
+  window_->SetContentSize(nu::SizeF(200, 400));
+  container_->SetAsyncLayout(true);
+  scoped_refptr<nu::Container> c = new nu::Container;
+  c->SetStyle("width", 50, "height", 60);
+  container_->AddChildView(c);
+  std::function<void()> check = [&]() {
+    if (c->GetBounds().width() > 0)
+      nu::MessageLoop::Quit();
+    else
+      nu::MessageLoop::PostDelayedTask(10, check);
+  };
+  nu::MessageLoop::PostTask(check);
+  nu::MessageLoop::Run();
+  // The results are copied to the CSS nodes.
+  EXPECT_EQ(YGNodeLayoutGetWidth(c->node()), 50);
+  EXPECT_EQ(YGNodeLayoutGetHeight(c->node()), 60);
+  // The new child must not reuse the frame of removed child.
+  scoped_refptr<nu::Container> d = new nu::Container;
+  d->SetStyle("width", 30, "height", 40);
+  nu::RectF initial = d->GetBounds();
+  container_->RemoveChildView(c.get());
+  container_->AddChildView(d);
+  EXPECT_EQ(d->GetBounds(), initial);
+  check = [&]() {
+    if (d->GetBounds().width() == 30)
+      nu::MessageLoop::Quit();
+    else
+      nu::MessageLoop::PostDelayedTask(10, check);
+  };
+  nu::MessageLoop::PostTask(check);
+  nu::MessageLoop::Run();
+  EXPECT_EQ(d->GetBounds(), nu::RectF(0, 0, 30, 40));
+  EXPECT_EQ(YGNodeLayoutGetHeight(d->node()), 40);
+}
+
+TEST_F(ContainerTest, AsyncLayoutNestedChild) {
+  window_->SetContentSize(nu::SizeF(200, 400));
+  container_->SetAsyncLayout(true);
+  scoped_refptr<nu::Container> nested = new nu::Container;
+  nested->SetStyle("width", 100, "height", 100);
+  container_->AddChildView(nested);
+  std::function<void()> check = [&]() {
+    if (nested->GetBounds().width() > 0)
+      nu::MessageLoop::Quit();
+    else
+      nu::MessageLoop::PostDelayedTask(10, check);
+  };
+  nu::MessageLoop::PostTask(check);
+  nu::MessageLoop::Run();
+  // Children added later must not get the uncalculated CSS bounds.
+  scoped_refptr<nu::Container> child = new nu::Container;
+  child->SetStyle("width", 30, "height", 40);
+  nu::RectF initial = child->GetBounds();
+  nested->AddChildView(child);
+  EXPECT_EQ(child->GetBounds(), initial);
+  check = [&]() {
+    if (child->GetBounds().width() == 30)
+      nu::MessageLoop::Quit();
+    else
+      nu::MessageLoop::PostDelayedTask(10, check);
+  };
+  nu::MessageLoop::PostTask(check);
+  nu::MessageLoop::Run();
+  EXPECT_EQ(child->GetBounds(), nu::RectF(0, 0, 30, 40));
+  EXPECT_EQ(nested->GetBounds(), nu::RectF(0, 0, 100, 100));
+}
+
 TEST_F(ContainerTest, ChildLayout) {
   window_->SetBounds(nu::RectF(0, 0, 100, 200));
   TestContainer* c1 = new TestContainer;
@@ -5,6 +5,8 @@
 #ifndef NATIVEUI_EVENTS_EVENT_H_
 #define NATIVEUI_EVENTS_EVENT_H_
 
+#include <vector>
+
 #include "nativeui/events/keyboard_codes.h"
 #include "nativeui/gfx/geometry/point_f.h"
 #include "nativeui/types.h"
@@ -56,6 +58,10 @@ struct NATIVEUI_EXPORT MouseEvent : public Event {
   int button;
   PointF position_in_view;
   PointF position_in_window;
+
+  // Positions in the view of the mouse moves coalesced into this event, from
+  // oldest to newest, not including |position_in_view|.
+  std::vector<PointF> history;
 };
 
 // Key events.
@@ -4,6 +4,8 @@
 
 #include "nativeui/gfx/attributed_text.h"
 
+#include <math.h>
+
 #include <utility>
 
 #include "nativeui/gfx/font.h"
@@ -13,12 +15,26 @@ namespace nu {
 
 namespace {
 
+// Number of sizes whose bounds are remembered.
+const size_t kMaxCachedBounds = 4;
+
 inline bool RangeInvalid(int start, int end) {
   return start < 0 || (end >= 0 && end <= start);
 }
 
+// Yoga uses NaN for undefined size, which should still match itself.
+inline bool SameLength(float a, float b) {
+  return a == b || (isnan(a) && isnan(b));
+}
+
 }  // namespace
 
+AttributedText::Range::Range() = default;
+
+AttributedText::Range::Range(const Range&) = default;
+
+AttributedText::Range::~Range() = default;
+
 // The system does not specify default system font and color for AttributedText
 // so convert format to attributes to pass default font and color implicitly.
 AttributedText::AttributedText(const std::string& text, TextFormat format)
@@ -26,6 +42,7 @@ AttributedText::AttributedText(const std::string& text, TextFormat format)
 
 void AttributedText::SetFormat(TextFormat format) {
   format_ = std::move(format);
+  bounds_cache_.clear();
   PlatformUpdateFormat();
 }
 
@@ -36,6 +53,7 @@ void AttributedText::SetFont(scoped_refptr<Font> font) {
 void AttributedText::SetFontFor(scoped_refptr<Font> font, int start, int end) {
   if (RangeInvalid(start, end))
     return;
+  bounds_cache_.clear();
   PlatformSetFontFor(std::move(font), start, end);
 }
 
@@ -49,12 +67,42 @@ void AttributedText::SetColorFor(Color color, int start, int end) {
   PlatformSetColorFor(color, start, end);
 }
 
+void AttributedText::SetAttributes(const std::vector<Range>& ranges) {
+  bounds_cache_.clear();
+  for (const Range& range : ranges) {
+    if (RangeInvalid(range.start, range.end))
+      continue;
+    if (range.font)
+      PlatformSetFontFor(range.font, range.start, range.end);
+    if (range.color)
+      PlatformSetColorFor(*range.color, range.start, range.end);
+  }
+}
+
 void AttributedText::Clear() {
   TextAttributes attrs;
   SetFont(std::move(attrs.font));
   SetColor(attrs.color);
 }
 
+RectF AttributedText::GetBoundsFor(const SizeF& size) const {
+  for (const auto& it : bounds_cache_) {
+    if (SameLength(it.first.width(), size.width()) &&
+        SameLength(it.first.height(), size.height()))
+      return it.second;
+  }
+  RectF bounds = PlatformGetBoundsFor(size);
+  if (bounds_cache_.size() >= kMaxCachedBounds)
+    bounds_cache_.erase(bounds_cache_.begin());
+  bounds_cache_.emplace_back(size, bounds);
+  return bounds;
+}
+
+void AttributedText::SetText(const std::string& text) {
+  bounds_cache_.clear();
+  PlatformSetText(text);
+}
+
 SizeF AttributedText::GetOneLineSize() const {
   return GetBoundsFor(SizeF(FLT_MAX, FLT_MAX)).size();
 }
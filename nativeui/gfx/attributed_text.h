@@ -5,21 +5,38 @@
 #ifndef NATIVEUI_GFX_ATTRIBUTED_TEXT_H_
 #define NATIVEUI_GFX_ATTRIBUTED_TEXT_H_
 
+#include <stdint.h>
+
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base/memory/ref_counted.h"
+#include "base/optional.h"
 #include "nativeui/gfx/color.h"
+#include "nativeui/gfx/geometry/rect_f.h"
 #include "nativeui/gfx/text.h"
 #include "nativeui/types.h"
 
 namespace nu {
 
 class Font;
-class RectF;
-class SizeF;
 
 class NATIVEUI_EXPORT AttributedText : public base::RefCounted<AttributedText> {
  public:
+  // Styles of text between character range [start, end), the styles that are
+  // not set are left unchanged.
+  struct NATIVEUI_EXPORT Range {
+    Range();
+    Range(const Range&);
+    ~Range();
+
+    int start = 0;
+    int end = -1;
+    scoped_refptr<Font> font;
+    base::Optional<Color> color;
+  };
+
   AttributedText(const std::string& text, TextFormat format);
   AttributedText(const std::string& text, TextAttributes att);
 #if defined(OS_WIN)
@@ -33,8 +50,11 @@ class NATIVEUI_EXPORT AttributedText : public base::RefCounted<AttributedText> {
   void SetFontFor(scoped_refptr<Font> font, int start, int end);
   void SetColor(Color color);
   void SetColorFor(Color color, int start, int end);
+  void SetAttributes(const std::vector<Range>& ranges);
   void Clear();
 
+  // The bounds are remembered for the last few sizes until the text, font or
+  // format is changed.
   RectF GetBoundsFor(const SizeF& size) const;
 
   void SetText(const std::string& text);
@@ -46,6 +66,12 @@ class NATIVEUI_EXPORT AttributedText : public base::RefCounted<AttributedText> {
 
   NativeAttributedText GetNative() const { return text_; }
 
+#if defined(OS_LINUX)
+  // Internal: Set the size of layout before drawing, since the bounds may be
+  // returned from cache without touching the layout.
+  void SetLayoutSize(const SizeF& size) const;
+#endif
+
  protected:
   virtual ~AttributedText();
 
@@ -55,9 +81,24 @@ class NATIVEUI_EXPORT AttributedText : public base::RefCounted<AttributedText> {
   void PlatformUpdateFormat();
   void PlatformSetFontFor(scoped_refptr<Font> font, int start, int end);
   void PlatformSetColorFor(Color color, int start, int end);
+  void PlatformSetText(const std::string& text);
+  RectF PlatformGetBoundsFor(const SizeF& size) const;
 
   NativeAttributedText text_;
   TextFormat format_;
+
+  // Bounds computed for recent sizes, the yoga measure callback is called with
+  // the same constraints for several times in one layout pass.
+  mutable std::vector<std::pair<SizeF, RectF>> bounds_cache_;
+
+#if defined(OS_LINUX)
+  // Convert character index to byte index in the UTF-8 text.
+  uint32_t CharIndexToByteIndex(int index) const;
+
+  // Pairs of (character index, byte index) after each non-ASCII character and
+  // at the end of text, built on first use after text is changed.
+  mutable std::vector<std::pair<uint32_t, uint32_t>> byte_offsets_;
+#endif
 };
 
 }  // namespace nu
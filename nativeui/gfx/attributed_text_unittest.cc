@@ -0,0 +1,89 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <math.h>
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+#if defined(OS_LINUX)
+#include <pango/pango.h>
+#endif
+
+class AttributedTextTest : public testing::Test {
+ protected:
+  nu::Lifetime lifetime_;
+  nu::State state_;
+};
+
+TEST_F(AttributedTextTest, CacheBounds) {
+  scoped_refptr<nu::AttributedText> text =
+      new nu::AttributedText("some text", nu::TextFormat());
+  nu::RectF bounds = text->GetBoundsFor(nu::SizeF(100, 100));
+  EXPECT_EQ(text->GetBoundsFor(nu::SizeF(100, 100)), bounds);
+  nu::SizeF undefined(NAN, NAN);
+  EXPECT_EQ(text->GetBoundsFor(undefined), text->GetBoundsFor(undefined));
+  EXPECT_EQ(text->GetBoundsFor(nu::SizeF(100, 100)), bounds);
+}
+
+TEST_F(AttributedTextTest, InvalidateBounds) {
+  scoped_refptr<nu::AttributedText> text =
+      new nu::AttributedText("text", nu::TextFormat());
+  nu::SizeF size = text->GetOneLineSize();
+  text->SetText("some longer text");
+  nu::SizeF longer = text->GetOneLineSize();
+  EXPECT_GT(longer.width(), size.width());
+  scoped_refptr<nu::Font> font = new nu::Font;
+  text->SetFont(font->Derive(30, nu::Font::Weight::Normal,
+                             nu::Font::Style::Normal));
+  EXPECT_GT(text->GetOneLineSize().height(), longer.height());
+}
+
+#if !defined(OS_WIN)
+TEST_F(AttributedTextTest, SetAttributes) {
+  scoped_refptr<nu::AttributedText> text =
+      new nu::AttributedText("中文 text", nu::TextFormat());
+  float height = text->GetOneLineHeight();
+  scoped_refptr<nu::Font> font = new nu::Font;
+  nu::AttributedText::Range range;
+  range.start = 3;
+  range.end = 7;
+  range.font = font->Derive(30, nu::Font::Weight::Normal,
+                            nu::Font::Style::Normal);
+  nu::AttributedText::Range color;
+  color.color = nu::Color(0xFF, 0, 0);
+  text->SetAttributes({range, color});
+  EXPECT_GT(text->GetOneLineHeight(), height);
+}
+#endif
+
+#if defined(OS_LINUX)
+TEST_F(AttributedTextTest, NonASCIIRangeToByteIndex) {
+  // "中文" and "é" take 3 and 2 bytes, "😀" takes 4 bytes and 2 characters.
+  scoped_refptr<nu::AttributedText> text =
+      new nu::AttributedText("中文 té😀xt", nu::TextFormat());
+  text->SetColorFor(nu::Color(0xFF, 0, 0), 3, 5);
+  text->SetColorFor(nu::Color(0, 0xFF, 0), 5, 100);
+  PangoAttrIterator* iter =
+      pango_attr_list_get_iterator(pango_layout_get_attributes(
+          text->GetNative()));
+  std::vector<std::pair<guint, guint>> ranges;
+  do {
+    PangoAttribute* attr = pango_attr_iterator_get(iter, PANGO_ATTR_FOREGROUND);
+    if (attr && attr->start_index > 0)
+      ranges.emplace_back(attr->start_index, attr->end_index);
+  } while (pango_attr_iterator_next(iter));
+  pango_attr_iterator_destroy(iter);
+  ASSERT_EQ(ranges.size(), 2u);
+  EXPECT_EQ(ranges[0], std::make_pair(7u, 10u));
+  EXPECT_EQ(ranges[1], std::make_pair(10u, 16u));
+}
+
+TEST_F(AttributedTextTest, InvalidUTF8) {
+  scoped_refptr<nu::AttributedText> text =
+      new nu::AttributedText("\xF0t", nu::TextFormat());
+  text->SetColorFor(nu::Color(0xFF, 0, 0), 1, 10);
+  EXPECT_FALSE(text->GetText().empty());
+}
+#endif
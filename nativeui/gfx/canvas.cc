@@ -4,6 +4,8 @@
 
 #include "nativeui/gfx/canvas.h"
 
+#include "base/logging.h"
+
 #include "nativeui/gfx/painter.h"
 #include "nativeui/screen.h"
 
@@ -24,4 +26,17 @@ Canvas::~Canvas() {
   PlatformDestroyBitmap(bitmap_);
 }
 
+Canvas::Pixels Canvas::LockPixels() {
+  DCHECK(!pixels_locked_) << "Pixels are already locked";
+  pixels_locked_ = true;
+  return PlatformLockPixels(bitmap_);
+}
+
+void Canvas::UnlockPixels() {
+  if (!pixels_locked_)
+    return;
+  pixels_locked_ = false;
+  PlatformUnlockPixels(bitmap_);
+}
+
 }  // namespace nu
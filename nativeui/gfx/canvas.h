@@ -8,7 +8,10 @@
 #include <memory>
 
 #include "base/memory/ref_counted.h"
+#include "nativeui/buffer.h"
+#include "nativeui/gfx/geometry/size.h"
 #include "nativeui/gfx/geometry/size_f.h"
+#include "nativeui/gfx/pixel_format.h"
 #include "nativeui/nativeui_export.h"
 #include "nativeui/types.h"
 
@@ -35,6 +38,27 @@ class NATIVEUI_EXPORT Canvas : public base::RefCounted<Canvas> {
   // Return the size of canvas.
   SizeF GetSize() const { return size_; }
 
+  // The raw pixels of canvas.
+  struct Pixels {
+    // Wraps the memory of canvas, which is only valid until UnlockPixels.
+    Buffer data;
+    // The size in pixels.
+    Size size;
+    // Bytes between the starts of adjacent rows.
+    int stride;
+    PixelFormat format;
+  };
+
+  // Return the memory of canvas's pixels without copying, which can be read
+  // and written directly. The painter must not be used until the pixels are
+  // unlocked.
+  Pixels LockPixels();
+
+  // Notify the canvas that direct access to pixels has finished.
+  void UnlockPixels();
+
+  bool IsPixelsLocked() const { return pixels_locked_; }
+
   // Internal: Return the native bitmap object.
   NativeBitmap GetBitmap() const { return bitmap_; }
 
@@ -51,12 +75,16 @@ class NATIVEUI_EXPORT Canvas : public base::RefCounted<Canvas> {
   static Painter* PlatformCreatePainter(NativeBitmap bitmap,
                                         const SizeF& size,
                                         float scale_factor);
+  static Pixels PlatformLockPixels(NativeBitmap bitmap);
+  static void PlatformUnlockPixels(NativeBitmap bitmap);
 
   float scale_factor_;
   SizeF size_;
 
   NativeBitmap bitmap_;
   std::unique_ptr<Painter> painter_;
+
+  bool pixels_locked_ = false;
 };
 
 }  // namespace nu
@@ -0,0 +1,76 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <stdint.h>
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class CanvasTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    canvas_ = new nu::Canvas(nu::SizeF(10, 10), 2.f);
+  }
+
+  uint32_t GetPixel(const nu::Canvas::Pixels& pixels, int x, int y) {
+    const uint8_t* row = static_cast<const uint8_t*>(pixels.data.content()) +
+                         y * pixels.stride;
+    return reinterpret_cast<const uint32_t*>(row)[x];
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  scoped_refptr<nu::Canvas> canvas_;
+};
+
+TEST_F(CanvasTest, LockPixels) {
+  nu::Canvas::Pixels pixels = canvas_->LockPixels();
+  EXPECT_TRUE(canvas_->IsPixelsLocked());
+  EXPECT_EQ(pixels.size, nu::Size(20, 20));
+  EXPECT_GE(pixels.stride, 20 * 4);
+  EXPECT_EQ(pixels.data.size(), static_cast<size_t>(pixels.stride * 20));
+  canvas_->UnlockPixels();
+  EXPECT_FALSE(canvas_->IsPixelsLocked());
+}
+
+TEST_F(CanvasTest, ReadPaintedPixels) {
+  nu::Painter* painter = canvas_->GetPainter();
+  painter->SetFillColor(nu::Color(0xFF, 0xFF, 0, 0));
+  painter->FillRect(nu::RectF(0, 0, 5, 5));
+  nu::Canvas::Pixels pixels = canvas_->LockPixels();
+  EXPECT_EQ(GetPixel(pixels, 0, 0), 0xFFFF0000u);
+  EXPECT_EQ(GetPixel(pixels, 9, 9), 0xFFFF0000u);
+  EXPECT_EQ(GetPixel(pixels, 10, 10) >> 24, 0u);
+  canvas_->UnlockPixels();
+}
+
+TEST_F(CanvasTest, WritePixels) {
+  nu::Canvas::Pixels pixels = canvas_->LockPixels();
+  uint8_t* row = static_cast<uint8_t*>(pixels.data.content()) +
+                 19 * pixels.stride;
+  reinterpret_cast<uint32_t*>(row)[19] = 0xFF0000FF;
+  canvas_->UnlockPixels();
+  // Drawing after unlocking keeps the written pixels.
+  canvas_->GetPainter()->FillRect(nu::RectF(0, 0, 1, 1));
+  pixels = canvas_->LockPixels();
+  EXPECT_EQ(GetPixel(pixels, 19, 19), 0xFF0000FFu);
+  canvas_->UnlockPixels();
+}
+
+TEST_F(CanvasTest, FillPath) {
+  scoped_refptr<nu::Path> path = new nu::Path;
+  path->Rect(nu::RectF(0, 0, 1, 1));
+  path->Scale(nu::Vector2dF(2, 2));
+  path->Translate(nu::Vector2dF(3, 3));
+  nu::Painter* painter = canvas_->GetPainter();
+  painter->SetFillColor(nu::Color(0xFF, 0xFF, 0, 0));
+  painter->FillPath(path.get());
+  // The path covers (3, 3) to (5, 5) in DIP.
+  nu::Canvas::Pixels pixels = canvas_->LockPixels();
+  EXPECT_EQ(GetPixel(pixels, 5, 5) >> 24, 0u);
+  EXPECT_EQ(GetPixel(pixels, 6, 6), 0xFFFF0000u);
+  EXPECT_EQ(GetPixel(pixels, 9, 9), 0xFFFF0000u);
+  EXPECT_EQ(GetPixel(pixels, 10, 10) >> 24, 0u);
+  canvas_->UnlockPixels();
+}
@@ -4,6 +4,7 @@
 
 #include "nativeui/gfx/font.h"
 
+#include "nativeui/gfx/font_registry.h"
 #include "nativeui/state.h"
 
 namespace nu {
@@ -17,7 +18,8 @@ Font* Font::Default() {
 }
 
 Font* Font::Derive(float size_delta, Weight weight, Style style) const {
-  return new Font(GetName(), GetSize() + size_delta, weight, style);
+  return FontRegistry::GetCurrent()->Get(
+      GetName(), GetSize() + size_delta, weight, style).get();
 }
 
 }  // namespace nu
@@ -60,7 +60,8 @@ class NATIVEUI_EXPORT Font : public base::RefCounted<Font> {
   // Create from from file path.
   Font(const base::FilePath& path, float size);
 
-  // Returns a new Font derived from the existing font.
+  // Returns a Font derived from the existing font, which is shared with other
+  // equal fonts in FontRegistry.
   // It is caller's responsibility to manage the lifetime of returned font.
   Font* Derive(float size_delta, Weight weight, Style style) const;
 
@@ -0,0 +1,57 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/font_registry.h"
+
+#include <algorithm>
+
+#include "nativeui/state.h"
+
+namespace nu {
+
+namespace {
+
+// Do not bother purging until there are this many fonts.
+const size_t kMinPurgeThreshold = 64;
+
+}  // namespace
+
+// static
+FontRegistry* FontRegistry::GetCurrent() {
+  return State::GetCurrent()->GetFontRegistry();
+}
+
+FontRegistry::FontRegistry() : purge_threshold_(kMinPurgeThreshold) {}
+
+FontRegistry::~FontRegistry() {}
+
+scoped_refptr<Font> FontRegistry::Get(const std::string& name,
+                                      float size,
+                                      Font::Weight weight,
+                                      Font::Style style) {
+  Key key(name, size, weight, style);
+  auto it = fonts_.find(key);
+  if (it != fonts_.end())
+    return it->second;
+  // Fonts are only kept alive by users, purge the unused ones when the
+  // registry grows, and leave room for growth so purging stays amortized.
+  if (fonts_.size() >= purge_threshold_) {
+    Purge();
+    purge_threshold_ = std::max(kMinPurgeThreshold, fonts_.size() * 2);
+  }
+  scoped_refptr<Font> font = new Font(name, size, weight, style);
+  fonts_[key] = font;
+  return font;
+}
+
+void FontRegistry::Purge() {
+  for (auto it = fonts_.begin(); it != fonts_.end();) {
+    if (it->second->HasOneRef())
+      it = fonts_.erase(it);
+    else
+      ++it;
+  }
+}
+
+}  // namespace nu
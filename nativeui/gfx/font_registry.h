@@ -0,0 +1,54 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_FONT_REGISTRY_H_
+#define NATIVEUI_GFX_FONT_REGISTRY_H_
+
+#include <map>
+#include <string>
+#include <tuple>
+
+#include "nativeui/gfx/font.h"
+
+namespace nu {
+
+// Interned fonts, so equal font descriptions share the same Font instance and
+// fonts can be compared by address. This class is managed by State.
+class NATIVEUI_EXPORT FontRegistry {
+ public:
+  ~FontRegistry();
+
+  static FontRegistry* GetCurrent();
+
+  // Return the font with |name|, |size|, |weight| and |style|, which is only
+  // created when there is no such font in the registry.
+  scoped_refptr<Font> Get(const std::string& name,
+                          float size,
+                          Font::Weight weight,
+                          Font::Style style);
+
+  // Remove the fonts that are only referenced by the registry.
+  void Purge();
+
+  // Return the number of fonts kept by the registry.
+  size_t GetCount() const { return fonts_.size(); }
+
+ private:
+  friend class State;
+
+  using Key = std::tuple<std::string, float, Font::Weight, Font::Style>;
+
+  FontRegistry();
+
+  std::map<Key, scoped_refptr<Font>> fonts_;
+
+  // Unused fonts are purged when the number of fonts reaches this size.
+  size_t purge_threshold_;
+
+  DISALLOW_COPY_AND_ASSIGN(FontRegistry);
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_FONT_REGISTRY_H_
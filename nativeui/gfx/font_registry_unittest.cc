@@ -0,0 +1,46 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class FontRegistryTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    registry_ = nu::FontRegistry::GetCurrent();
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  nu::FontRegistry* registry_;
+};
+
+TEST_F(FontRegistryTest, ShareEqualFonts) {
+  scoped_refptr<nu::Font> font = registry_->Get(
+      "Arial", 12, nu::Font::Weight::Normal, nu::Font::Style::Normal);
+  EXPECT_EQ(registry_->Get("Arial", 12, nu::Font::Weight::Normal,
+                           nu::Font::Style::Normal), font);
+  EXPECT_NE(registry_->Get("Arial", 12, nu::Font::Weight::Bold,
+                           nu::Font::Style::Normal), font);
+  EXPECT_EQ(registry_->GetCount(), 2u);
+}
+
+TEST_F(FontRegistryTest, Derive) {
+  scoped_refptr<nu::Font> font = nu::Font::Default();
+  scoped_refptr<nu::Font> bold = font->Derive(1, nu::Font::Weight::Bold,
+                                              nu::Font::Style::Normal);
+  EXPECT_EQ(font->Derive(1, nu::Font::Weight::Bold, nu::Font::Style::Normal),
+            bold);
+}
+
+TEST_F(FontRegistryTest, Purge) {
+  scoped_refptr<nu::Font> font = registry_->Get(
+      "Arial", 12, nu::Font::Weight::Normal, nu::Font::Style::Normal);
+  registry_->Get("Arial", 13, nu::Font::Weight::Normal,
+                 nu::Font::Style::Normal);
+  registry_->Purge();
+  EXPECT_EQ(registry_->GetCount(), 1u);
+  EXPECT_EQ(registry_->Get("Arial", 12, nu::Font::Weight::Normal,
+                           nu::Font::Style::Normal), font);
+}
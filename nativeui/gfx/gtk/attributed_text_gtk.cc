@@ -4,13 +4,15 @@
 
 #include "nativeui/gfx/attributed_text.h"
 
-#include <math.h>
-
 #include <gtk/gtk.h>
+#include <math.h>
 #include <pango/pango.h>
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
 
 #include "base/logging.h"
-#include "base/strings/utf_string_conversions.h"
 #include "nativeui/gfx/font.h"
 #include "nativeui/gfx/geometry/rect_f.h"
 #include "nativeui/gfx/geometry/size_f.h"
@@ -20,22 +22,6 @@ namespace nu {
 
 namespace {
 
-// Convert the character index to byte index.
-guint CharIndexToByteIndex(const base::string16& text, int index) {
-  if (index < 0)
-    return G_MAXUINT;
-  return base::UTF16ToUTF8(text.substr(0, index)).size();
-}
-
-void FillPangoAttributeIndex(PangoAttribute* attr, PangoLayout* layout,
-                             int start, int end) {
-  if (start == 0 && end < 0)  // this is the most common case
-    return;
-  base::string16 text = base::UTF8ToUTF16(pango_layout_get_text(layout));
-  attr->start_index = CharIndexToByteIndex(text, start);
-  attr->end_index = CharIndexToByteIndex(text, end);
-}
-
 // Find and remove the attribute of type.
 gboolean FilterAttributeType(PangoAttribute* attr, PangoAttrType type) {
   return attr->klass->type == type;
@@ -102,7 +88,10 @@ void AttributedText::PlatformSetFontFor(scoped_refptr<Font> font,
     RemoveFromAttributeList(attrs, PANGO_ATTR_FONT_DESC);
 
   PangoAttribute* font_attr = pango_attr_font_desc_new(font->GetNative());
-  FillPangoAttributeIndex(font_attr, text_, start, end);
+  if (start != 0 || end >= 0) {  // most common case is the whole text
+    font_attr->start_index = CharIndexToByteIndex(start);
+    font_attr->end_index = CharIndexToByteIndex(end);
+  }
   pango_attr_list_insert(attrs, font_attr);  // ownership taken
 }
 
@@ -115,11 +104,14 @@ void AttributedText::PlatformSetColorFor(Color color, int start, int end) {
       color.r() / 255. * 65535,
       color.g() / 255. * 65535,
       color.b() / 255. * 65535);
-  FillPangoAttributeIndex(fg_attr, text_, start, end);
+  if (start != 0 || end >= 0) {  // most common case is the whole text
+    fg_attr->start_index = CharIndexToByteIndex(start);
+    fg_attr->end_index = CharIndexToByteIndex(end);
+  }
   pango_attr_list_insert(attrs, fg_attr);  // ownership taken
 }
 
-RectF AttributedText::GetBoundsFor(const SizeF& size) const {
+void AttributedText::SetLayoutSize(const SizeF& size) const {
   if (format_.wrap) {
     // Yoga may pass 0 as width to indicate no wrapping.
     if (size.width() == 0 || isnan(size.width()))
@@ -128,12 +120,17 @@ RectF AttributedText::GetBoundsFor(const SizeF& size) const {
       pango_layout_set_width(text_, size.width() * PANGO_SCALE);
     pango_layout_set_height(text_, size.height() * PANGO_SCALE);
   }
+}
+
+RectF AttributedText::PlatformGetBoundsFor(const SizeF& size) const {
+  SetLayoutSize(size);
   int width, height;
   pango_layout_get_pixel_size(text_, &width, &height);
   return RectF(0, 0, width, height);
 }
 
-void AttributedText::SetText(const std::string& text) {
+void AttributedText::PlatformSetText(const std::string& text) {
+  byte_offsets_.clear();
   pango_layout_set_text(text_, text.c_str(), text.length());
 }
 
@@ -141,4 +138,41 @@ std::string AttributedText::GetText() const {
   return pango_layout_get_text(text_);
 }
 
+uint32_t AttributedText::CharIndexToByteIndex(int index) const {
+  if (index < 0)
+    return G_MAXUINT;
+  if (byte_offsets_.empty()) {
+    // Character index is counted in UTF-16 code units, which only differs
+    // from byte index after non-ASCII characters.
+    const char* text = pango_layout_get_text(text_);
+    const char* end = text + strlen(text);
+    uint32_t char_index = 0;
+    for (const char* p = text; p < end;) {
+      if (static_cast<uint8_t>(*p) < 0x80) {
+        ++char_index;
+        ++p;
+        continue;
+      }
+      // Pango stores invalid bytes as 0xFF, which is skipped as one byte.
+      const char* next = std::min(g_utf8_next_char(p), end);
+      char_index += next - p == 4 ? 2 : 1;  // surrogate pair
+      p = next;
+      byte_offsets_.emplace_back(char_index, static_cast<uint32_t>(p - text));
+    }
+    byte_offsets_.emplace_back(char_index, static_cast<uint32_t>(end - text));
+  }
+  // Index past the end is clamped.
+  if (static_cast<uint32_t>(index) >= byte_offsets_.back().first)
+    return byte_offsets_.back().second;
+  // Find the last non-ASCII character before index, characters after it are
+  // all ASCII.
+  auto it = std::upper_bound(
+      byte_offsets_.begin(), byte_offsets_.end(),
+      std::make_pair(static_cast<uint32_t>(index), G_MAXUINT));
+  if (it == byte_offsets_.begin())
+    return index;
+  --it;
+  return it->second + (index - it->first);
+}
+
 }  // namespace nu
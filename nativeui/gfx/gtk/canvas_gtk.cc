@@ -31,4 +31,22 @@ Painter* Canvas::PlatformCreatePainter(NativeBitmap bitmap,
   return new PainterGtk(bitmap, size, scale_factor);
 }
 
+// static
+Canvas::Pixels Canvas::PlatformLockPixels(NativeBitmap bitmap) {
+  // Finish pending drawing operations before exposing the memory.
+  cairo_surface_flush(bitmap);
+  int stride = cairo_image_surface_get_stride(bitmap);
+  Size size(cairo_image_surface_get_width(bitmap),
+            cairo_image_surface_get_height(bitmap));
+  return {Buffer::Wrap(cairo_image_surface_get_data(bitmap),
+                       stride * size.height()),
+          size, stride, PixelFormat::ARGB32Premultiplied};
+}
+
+// static
+void Canvas::PlatformUnlockPixels(NativeBitmap bitmap) {
+  // Cairo may cache the content, tell it the memory has changed.
+  cairo_surface_mark_dirty(bitmap);
+}
+
 }  // namespace nu
@@ -5,18 +5,179 @@
 #include "nativeui/gfx/image.h"
 
 #include <gtk/gtk.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace nu {
 
 namespace {
 
+// Max number of scaled surfaces cached for each image.
+const size_t kMaxScaledSurfaces = 4;
+
+// Max bytes of pre-rendered frames for each animation, larger animations are
+// decoded frame by frame when playing.
+const uint64_t kMaxFramesBytes = 32 * 1024 * 1024;
+
+// Browsers treat very short GIF delays as this value.
+const int kMinFrameDelay = 20;
+
+bool IsGif(const uint8_t* data, size_t size) {
+  return size >= 13 && memcmp(data, "GIF8", 4) == 0;
+}
+
+// Count the frames of GIF |data| by walking its blocks, and read the loop
+// count of NETSCAPE2.0 extension into |loop_count|, which is left unchanged
+// when the extension is missing. Return 0 for data that is not GIF.
+int CountGifFrames(const uint8_t* data, size_t size, int* loop_count) {
+  if (!IsGif(data, size))
+    return 0;
+  size_t pos = 13;
+  // Skip global color table.
+  if (data[10] & 0x80)
+    pos += 3 << ((data[10] & 0x07) + 1);
+  auto skip_sub_blocks = [&]() {
+    while (pos < size && data[pos] != 0)
+      pos += data[pos] + 1;
+    pos++;
+  };
+  int count = 0;
+  while (pos < size) {
+    switch (data[pos]) {
+      case 0x21:  // extension
+        // The application extension is followed by a sub-block of 3 bytes,
+        // which stores the little-endian loop count after the 0x01 id.
+        if (pos + 19 <= size && data[pos + 1] == 0xFF &&
+            memcmp(data + pos + 2, "\x0bNETSCAPE2.0\x03\x01", 14) == 0)
+          *loop_count = data[pos + 16] | (data[pos + 17] << 8);
+        pos += 2;
+        skip_sub_blocks();
+        break;
+      case 0x2C: {  // image descriptor
+        if (pos + 10 > size)
+          return count;
+        uint8_t flags = data[pos + 9];
+        pos += 10;
+        // Skip local color table and LZW minimum code size.
+        if (flags & 0x80)
+          pos += 3 << ((flags & 0x07) + 1);
+        pos++;
+        skip_sub_blocks();
+        count++;
+        break;
+      }
+      default:  // trailer or corrupted data
+        return count;
+    }
+  }
+  return count;
+}
+
+// Convert |frame| to a premultiplied cairo surface.
+cairo_surface_t* CreateSurfaceFromPixbuf(GdkPixbuf* frame) {
+  if (!gdk_pixbuf_get_has_alpha(frame) ||
+      gdk_pixbuf_get_n_channels(frame) != 4 ||
+      gdk_pixbuf_get_bits_per_sample(frame) != 8)
+    return gdk_cairo_surface_create_from_pixbuf(frame, 1, nullptr);
+  // Use the SIMD conversion for the common RGBA format.
+  Size size(gdk_pixbuf_get_width(frame), gdk_pixbuf_get_height(frame));
+  cairo_surface_t* surface = cairo_image_surface_create(
+      CAIRO_FORMAT_ARGB32, size.width(), size.height());
+  cairo_surface_flush(surface);
+  ConvertPixels(size,
+                gdk_pixbuf_read_pixels(frame),
+                gdk_pixbuf_get_rowstride(frame),
+                PixelFormat::RGBA,
+                cairo_image_surface_get_data(surface),
+                cairo_image_surface_get_stride(surface),
+                PixelFormat::ARGB32Premultiplied);
+  cairo_surface_mark_dirty(surface);
+  return surface;
+}
+
+size_t GetSurfaceBytes(cairo_surface_t* surface) {
+  return static_cast<size_t>(cairo_image_surface_get_stride(surface)) *
+         cairo_image_surface_get_height(surface);
+}
+
+// Return a copy of |surface| scaled to |pixel_size|.
+cairo_surface_t* CreateScaledSurface(cairo_surface_t* surface,
+                                     const Size& pixel_size) {
+  cairo_surface_t* scaled = cairo_image_surface_create(
+      CAIRO_FORMAT_ARGB32, pixel_size.width(), pixel_size.height());
+  cairo_t* cr = cairo_create(scaled);
+  cairo_scale(cr,
+              static_cast<double>(pixel_size.width()) /
+                  cairo_image_surface_get_width(surface),
+              static_cast<double>(pixel_size.height()) /
+                  cairo_image_surface_get_height(surface));
+  cairo_set_source_surface(cr, surface, 0, 0);
+  cairo_pattern_set_filter(cairo_get_source(cr), CAIRO_FILTER_GOOD);
+  cairo_paint(cr);
+  cairo_destroy(cr);
+  return scaled;
+}
+
+// Create an animation with only 1 frame.
+NativeImage CreateStaticImage(GdkPixbuf* frame) {
+  GdkPixbufSimpleAnim* image = gdk_pixbuf_simple_anim_new(
+      gdk_pixbuf_get_width(frame), gdk_pixbuf_get_height(frame), 1.f);
+  gdk_pixbuf_simple_anim_add_frame(image, frame);
+  return GDK_PIXBUF_ANIMATION(image);
+}
+
 // Create an empty image with only 1 frame.
 NativeImage CreateEmptyImage() {
-  GdkPixbufSimpleAnim* image = gdk_pixbuf_simple_anim_new(1, 1, 1.f);
   GdkPixbuf* frame = gdk_pixbuf_new(GDK_COLORSPACE_RGB, true, 8, 1, 1);
-  gdk_pixbuf_simple_anim_add_frame(image, frame);
+  NativeImage image = CreateStaticImage(frame);
   g_object_unref(frame);
-  return GDK_PIXBUF_ANIMATION(image);
+  return image;
+}
+
+struct DecodeSizeData {
+  SizeF max_size;
+  float scale_factor;
+};
+
+// Ask the loader to decode at the scaled size, most decoders can then skip
+// the unneeded pixels instead of decoding the full image.
+void OnSizePrepared(GdkPixbufLoader* loader, int width, int height,
+                    const DecodeSizeData* data) {
+  Size size(width, height);
+  Size decode_size = Image::GetDecodeSize(size, data->max_size,
+                                          data->scale_factor);
+  if (decode_size != size)
+    gdk_pixbuf_loader_set_size(loader, decode_size.width(),
+                               decode_size.height());
+}
+
+// Read the file with |loader| in chunks, and keep a copy of the content in
+// |gif_data| if the file is GIF.
+bool LoadFile(GdkPixbufLoader* loader,
+              const base::FilePath& path,
+              std::vector<uint8_t>* gif_data = nullptr) {
+  FILE* file = fopen(path.value().c_str(), "rb");
+  if (!file)
+    return false;
+  bool success = true;
+  bool first_chunk = true;
+  bool is_gif = false;
+  guchar chunk[64 * 1024];
+  size_t size;
+  while (success && (size = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    if (first_chunk)
+      is_gif = gif_data && IsGif(chunk, size);
+    first_chunk = false;
+    if (is_gif)
+      gif_data->insert(gif_data->end(), chunk, chunk + size);
+    success = gdk_pixbuf_loader_write(loader, chunk, size, nullptr);
+  }
+  fclose(file);
+  // The loader must always be closed.
+  return gdk_pixbuf_loader_close(loader, nullptr) && success;
 }
 
 }  // namespace
@@ -24,15 +185,27 @@ NativeImage CreateEmptyImage() {
 Image::Image() : image_(CreateEmptyImage()), is_empty_(true) {}
 
 Image::Image(const base::FilePath& p)
-    : scale_factor_(GetScaleFactorFromFilePath(p)),
-      image_(gdk_pixbuf_animation_new_from_file(p.value().c_str(), nullptr)) {
+    : scale_factor_(GetScaleFactorFromFilePath(p)), image_(nullptr) {
+  // Read the file only once, GIF content is kept for counting frames.
+  std::vector<uint8_t> gif_data;
+  GdkPixbufLoader* loader = gdk_pixbuf_loader_new();
+  if (LoadFile(loader, p, &gif_data)) {
+    image_ = gdk_pixbuf_loader_get_animation(loader);
+    if (image_)
+      g_object_ref(image_);
+  }
+  g_object_unref(loader);
   // When file reading failed |image_| could be nullptr, having a null
   // native image is very dangerous so we create an empty image when it
   // happens.
   if (!image_) {
     image_ = CreateEmptyImage();
     is_empty_ = true;
+    return;
   }
+  if (!gdk_pixbuf_animation_is_static_image(image_))
+    frames_count_ = CountGifFrames(gif_data.data(), gif_data.size(),
+                                   &loop_count_);
 }
 
 Image::Image(const Buffer& buffer, float scale_factor)
@@ -43,11 +216,61 @@ Image::Image(const Buffer& buffer, float scale_factor)
   if (!image_) {
     image_ = CreateEmptyImage();
     is_empty_ = true;
+  } else if (!gdk_pixbuf_animation_is_static_image(image_)) {
+    frames_count_ = CountGifFrames(
+        static_cast<const uint8_t*>(buffer.content()), buffer.size(),
+        &loop_count_);
   }
   g_object_unref(stream);
 }
 
+Image::Image(const Buffer& pixels,
+             const Size& size,
+             int stride,
+             PixelFormat format,
+             float scale_factor)
+    : scale_factor_(scale_factor) {
+  if (!IsValidPixelBuffer(size, stride, pixels.size())) {
+    image_ = CreateEmptyImage();
+    is_empty_ = true;
+    return;
+  }
+  // GdkPixbuf stores pixels in RGBA without premultiplication.
+  GdkPixbuf* frame = gdk_pixbuf_new(GDK_COLORSPACE_RGB, true, 8,
+                                    size.width(), size.height());
+  ConvertPixels(size, pixels.content(), stride, format,
+                gdk_pixbuf_get_pixels(frame), gdk_pixbuf_get_rowstride(frame),
+                PixelFormat::RGBA);
+  image_ = CreateStaticImage(frame);
+  g_object_unref(frame);
+}
+
+Image::Image(const base::FilePath& p, const SizeF& max_size)
+    : scale_factor_(GetScaleFactorFromFilePath(p)), image_(nullptr) {
+  DecodeSizeData data = {max_size, scale_factor_};
+  GdkPixbufLoader* loader = gdk_pixbuf_loader_new();
+  g_signal_connect(loader, "size-prepared", G_CALLBACK(OnSizePrepared), &data);
+  // Note that the loader turns a scaled animation into a static image.
+  if (LoadFile(loader, p)) {
+    image_ = gdk_pixbuf_loader_get_animation(loader);
+    if (image_)
+      g_object_ref(image_);
+  }
+  g_object_unref(loader);
+  if (!image_) {
+    image_ = CreateEmptyImage();
+    is_empty_ = true;
+  }
+}
+
 Image::~Image() {
+  ClearCairoSurfaces();
+  for (cairo_surface_t* surface : scaled_frames_) {
+    if (surface)
+      cairo_surface_destroy(surface);
+  }
+  for (const Frame& frame : frames_)
+    cairo_surface_destroy(frame.surface);
   g_object_unref(image_);
   if (iter_)
     g_object_unref(iter_);
@@ -65,6 +288,16 @@ SizeF Image::GetSize() const {
                    1.f / scale_factor_);
 }
 
+size_t Image::GetMemorySize() const {
+  if (is_empty_)
+    return 0;
+  // gdk-pixbuf keeps one decoded pixbuf for each frame of animations.
+  size_t bytes = static_cast<size_t>(gdk_pixbuf_animation_get_width(image_)) *
+                 gdk_pixbuf_animation_get_height(image_) * 4 *
+                 std::max(frames_count_, 1);
+  return bytes + frames_bytes_ + surfaces_bytes_;
+}
+
 bool Image::WriteToFile(const std::string& format,
                         const base::FilePath& target) {
   GdkPixbuf* pixbuf = gdk_pixbuf_animation_get_static_image(image_);
@@ -73,12 +306,159 @@ bool Image::WriteToFile(const std::string& format,
 }
 
 void Image::AdvanceFrame() {
-  GTimeVal time;
-  g_get_current_time(&time);
-  if (iter_)
-    gdk_pixbuf_animation_iter_advance(iter_, &time);
-  else
-    iter_ = gdk_pixbuf_animation_get_iter(image_, &time);
+  if (!frames_cached_)
+    CacheFrames();
+  if (frames_.empty()) {
+    GTimeVal time;
+    g_get_current_time(&time);
+    // The loader may reuse one pixbuf for all frames, so rely on the return
+    // value instead of pixbuf address to know if frame has changed.
+    if (!iter_)
+      iter_ = gdk_pixbuf_animation_get_iter(image_, &time);
+    else if (gdk_pixbuf_animation_iter_advance(iter_, &time))
+      ClearCairoSurfaces();
+    return;
+  }
+  int64_t now = g_get_monotonic_time();
+  if (frame_deadline_ == 0 || now - frame_deadline_ > frames_duration_ * 1000) {
+    // Start playing, or restart current frame after a long pause instead of
+    // skipping through all missed frames.
+    frame_deadline_ = now + std::max(GetCachedFrameDelay(frame_index_),
+                                     kMinFrameDelay) * 1000;
+    return;
+  }
+  size_t index = frame_index_;
+  while (GetCachedFrameDelay(index) >= 0 && now >= frame_deadline_) {
+    index = (index + 1) % frames_.size();
+    if (index == 0)
+      ++loops_played_;
+    frame_deadline_ += std::max(GetCachedFrameDelay(index),
+                                kMinFrameDelay) * 1000;
+  }
+  if (index != frame_index_) {
+    frame_index_ = index;
+    ClearCairoSurfaces();
+  }
+}
+
+int Image::GetFrameDelay() const {
+  if (frames_.empty())
+    return iter_ ? gdk_pixbuf_animation_iter_get_delay_time(iter_) : -1;
+  if (GetCachedFrameDelay(frame_index_) < 0)
+    return -1;
+  int64_t remaining = (frame_deadline_ - g_get_monotonic_time()) / 1000;
+  return static_cast<int>(std::max<int64_t>(remaining, 0));
+}
+
+void Image::CacheFrames() {
+  frames_cached_ = true;
+  if (frames_count_ < 2)
+    return;
+  uint64_t width = gdk_pixbuf_animation_get_width(image_);
+  uint64_t height = gdk_pixbuf_animation_get_height(image_);
+  if (width * height * 4 * frames_count_ > kMaxFramesBytes)
+    return;
+  // Step a private iter with a fake clock to visit each frame once.
+  GTimeVal time = {0, 0};
+  GdkPixbufAnimationIter* iter = gdk_pixbuf_animation_get_iter(image_, &time);
+  for (int i = 0; i < frames_count_; ++i) {
+    int delay = gdk_pixbuf_animation_iter_get_delay_time(iter);
+    frames_.push_back({
+        CreateSurfaceFromPixbuf(gdk_pixbuf_animation_iter_get_pixbuf(iter)),
+        delay});
+    if (delay < 0)  // the animation does not loop
+      break;
+    frames_duration_ += std::max(delay, kMinFrameDelay);
+    g_time_val_add(&time, std::max(delay, 1) * 1000L);
+    gdk_pixbuf_animation_iter_advance(iter, &time);
+  }
+  g_object_unref(iter);
+  frames_bytes_ = width * height * 4 * frames_.size();
+}
+
+int Image::GetCachedFrameDelay(size_t index) const {
+  // The last frame of the last loop never ends.
+  if (loop_count_ > 0 && loops_played_ >= loop_count_ - 1 &&
+      index == frames_.size() - 1)
+    return -1;
+  return frames_[index].delay;
+}
+
+GdkPixbuf* Image::GetFrame() const {
+  return iter_ ? gdk_pixbuf_animation_iter_get_pixbuf(iter_)
+               : gdk_pixbuf_animation_get_static_image(image_);
+}
+
+cairo_surface_t* Image::GetCairoSurface() const {
+  if (!frames_.empty())
+    return frames_[frame_index_].surface;
+  GdkPixbuf* frame = GetFrame();
+  if (surface_ && frame == surface_frame_)
+    return surface_;
+  // The frame has changed, all cached surfaces are outdated.
+  ClearCairoSurfaces();
+  surface_frame_ = GDK_PIXBUF(g_object_ref(frame));
+  surface_ = CreateSurfaceFromPixbuf(frame);
+  surfaces_bytes_ += GetSurfaceBytes(surface_);
+  return surface_;
+}
+
+cairo_surface_t* Image::GetScaledCairoSurface(const Size& pixel_size) const {
+  // Keep a scaled copy of every frame when they fit in memory, so playing
+  // a scaled animation only blits.
+  uint64_t scaled_bytes = static_cast<uint64_t>(pixel_size.width()) *
+                          pixel_size.height() * 4 * frames_.size();
+  if (!frames_.empty() && frames_bytes_ + scaled_bytes <= kMaxFramesBytes) {
+    if (scaled_frames_size_ != pixel_size) {
+      for (cairo_surface_t* surface : scaled_frames_) {
+        if (surface) {
+          surfaces_bytes_ -= GetSurfaceBytes(surface);
+          cairo_surface_destroy(surface);
+        }
+      }
+      scaled_frames_.assign(frames_.size(), nullptr);
+      scaled_frames_size_ = pixel_size;
+    }
+    cairo_surface_t*& scaled = scaled_frames_[frame_index_];
+    if (!scaled) {
+      scaled = CreateScaledSurface(frames_[frame_index_].surface, pixel_size);
+      surfaces_bytes_ += GetSurfaceBytes(scaled);
+    }
+    return scaled;
+  }
+  cairo_surface_t* surface = GetCairoSurface();
+  for (auto it = scaled_surfaces_.begin(); it != scaled_surfaces_.end(); ++it) {
+    if (it->first == pixel_size) {
+      std::rotate(it, it + 1, scaled_surfaces_.end());
+      return scaled_surfaces_.back().second;
+    }
+  }
+  if (scaled_surfaces_.size() >= kMaxScaledSurfaces) {
+    surfaces_bytes_ -= GetSurfaceBytes(scaled_surfaces_.front().second);
+    cairo_surface_destroy(scaled_surfaces_.front().second);
+    scaled_surfaces_.erase(scaled_surfaces_.begin());
+  }
+  cairo_surface_t* scaled = CreateScaledSurface(surface, pixel_size);
+  surfaces_bytes_ += GetSurfaceBytes(scaled);
+  scaled_surfaces_.emplace_back(pixel_size, scaled);
+  return scaled;
+}
+
+void Image::ClearCairoSurfaces() const {
+  for (const auto& it : scaled_surfaces_) {
+    surfaces_bytes_ -= GetSurfaceBytes(it.second);
+    cairo_surface_destroy(it.second);
+  }
+  scaled_surfaces_.clear();
+  if (surface_) {
+    surfaces_bytes_ -= GetSurfaceBytes(surface_);
+    cairo_surface_destroy(surface_);
+    surface_ = nullptr;
+  }
+  if (surface_frame_) {
+    g_object_unref(surface_frame_);
+    surface_frame_ = nullptr;
+  }
 }
 
 }  // namespace nu
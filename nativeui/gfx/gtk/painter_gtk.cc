@@ -10,15 +10,43 @@
 #include <gtk/gtk.h>
 #include <math.h>
 
+#include <cmath>
 #include <utility>
 
 #include "nativeui/gfx/attributed_text.h"
 #include "nativeui/gfx/canvas.h"
 #include "nativeui/gfx/font.h"
+#include "nativeui/gfx/geometry/rect_conversions.h"
 #include "nativeui/gfx/image.h"
+#include "nativeui/gfx/path.h"
 
 namespace nu {
 
+namespace {
+
+// Images larger than this are not pre-scaled, to bound the memory.
+const int kMaxScaledImageSize = 2048;
+
+// Compute the size in device pixels of |size| under current transform, fails
+// if the transform has rotation.
+bool GetDevicePixelSize(cairo_t* cr, const SizeF& size, Size* out) {
+  cairo_matrix_t matrix;
+  cairo_get_matrix(cr, &matrix);
+  if (matrix.xy != 0 || matrix.yx != 0)
+    return false;
+  double x_scale = 1, y_scale = 1;
+  cairo_surface_get_device_scale(cairo_get_target(cr), &x_scale, &y_scale);
+  int width = std::lround(std::fabs(size.width() * matrix.xx * x_scale));
+  int height = std::lround(std::fabs(size.height() * matrix.yy * y_scale));
+  if (width <= 0 || height <= 0 ||
+      width > kMaxScaledImageSize || height > kMaxScaledImageSize)
+    return false;
+  *out = Size(width, height);
+  return true;
+}
+
+}  // namespace
+
 PainterGtk::PainterGtk(cairo_t* context, SizeF size)
     : context_(context),
       size_(std::move(size)),
@@ -130,6 +158,27 @@ void PainterGtk::Fill() {
   cairo_fill(context_);
 }
 
+void PainterGtk::StrokePath(const Path* path) {
+  cairo_new_path(context_);
+  cairo_path_t* native = path->GetNative();
+  // Appending a path in error state would break the context.
+  if (native->status != CAIRO_STATUS_SUCCESS)
+    return;
+  cairo_append_path(context_, native);
+  SetSourceColor(true);
+  cairo_stroke(context_);
+}
+
+void PainterGtk::FillPath(const Path* path) {
+  cairo_new_path(context_);
+  cairo_path_t* native = path->GetNative();
+  if (native->status != CAIRO_STATUS_SUCCESS)
+    return;
+  cairo_append_path(context_, native);
+  SetSourceColor(false);
+  cairo_fill(context_);
+}
+
 void PainterGtk::Clear() {
   cairo_save(context_);
   cairo_set_operator(context_, CAIRO_OPERATOR_CLEAR);
@@ -164,17 +213,29 @@ void PainterGtk::DrawImageFromRect(const Image* image, const RectF& src,
   cairo_new_path(context_);
   cairo_rectangle(context_, 0, 0, dest.width(), dest.height());
   cairo_clip(context_);
-  // Scale if needed.
-  float x_scale = dest.width() / ps.width();
-  float y_scale = dest.height() / ps.height();
-  if (x_scale != 1.0f || y_scale != 1.0f)
-    cairo_scale(context_, x_scale, y_scale);
-  // Choose the correct image.
-  GdkPixbuf* pixbuf = image->iter() ?
-      gdk_pixbuf_animation_iter_get_pixbuf(image->iter()) :
-      gdk_pixbuf_animation_get_static_image(image->GetNative());
+  // Drawing the whole image scaled is the common case for icons, use a cached
+  // pre-scaled surface so steady repaints do not convert or scale pixels.
+  Size image_size(gdk_pixbuf_animation_get_width(image->GetNative()),
+                  gdk_pixbuf_animation_get_height(image->GetNative()));
+  Size pixel_size;
+  if (ToNearestRect(ps) == nu::Rect(image_size) &&
+      GetDevicePixelSize(context_, dest.size(), &pixel_size) &&
+      pixel_size != image_size) {
+    cairo_scale(context_,
+                dest.width() / pixel_size.width(),
+                dest.height() / pixel_size.height());
+    cairo_set_source_surface(context_,
+                             image->GetScaledCairoSurface(pixel_size), 0, 0);
+  } else {
+    // Scale if needed.
+    float x_scale = dest.width() / ps.width();
+    float y_scale = dest.height() / ps.height();
+    if (x_scale != 1.0f || y_scale != 1.0f)
+      cairo_scale(context_, x_scale, y_scale);
+    cairo_set_source_surface(context_, image->GetCairoSurface(),
+                             -ps.x(), -ps.y());
+  }
   // Draw.
-  gdk_cairo_set_source_pixbuf(context_, pixbuf, -ps.x(), -ps.y());
   cairo_paint(context_);
   cairo_restore(context_);
 }
@@ -219,6 +280,7 @@ void PainterGtk::DrawAttributedText(scoped_refptr<AttributedText> text,
   cairo_move_to(context_, target.x(), target.y());
 
   // Draw.
+  text->SetLayoutSize(rect.size());
   PangoLayout* layout = text->GetNative();
   pango_cairo_show_layout(context_, layout);
   cairo_restore(context_);
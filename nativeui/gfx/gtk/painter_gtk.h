@@ -44,6 +44,8 @@ class PainterGtk : public Painter {
   void SetLineWidth(float width) override;
   void Stroke() override;
   void Fill() override;
+  void StrokePath(const Path* path) override;
+  void FillPath(const Path* path) override;
   void Clear() override;
   void StrokeRect(const RectF& rect) override;
   void FillRect(const RectF& rect) override;
@@ -0,0 +1,60 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/path.h"
+
+#include <cairo.h>
+
+namespace nu {
+
+NativePath Path::PlatformCreate() const {
+  // Build the path on a scratch context with the transform applied, and copy
+  // it out in device space.
+  cairo_surface_t* surface = cairo_image_surface_create(CAIRO_FORMAT_A8, 0, 0);
+  cairo_t* cr = cairo_create(surface);
+  cairo_matrix_t matrix;
+  cairo_matrix_init(&matrix, matrix_[0], matrix_[1], matrix_[2], matrix_[3],
+                    matrix_[4], matrix_[5]);
+  cairo_set_matrix(cr, &matrix);
+  const float* a = args_.data();
+  for (Op op : ops_) {
+    switch (op) {
+      case Op::MoveTo:
+        cairo_move_to(cr, a[0], a[1]);
+        a += 2;
+        break;
+      case Op::LineTo:
+        cairo_line_to(cr, a[0], a[1]);
+        a += 2;
+        break;
+      case Op::BezierCurveTo:
+        cairo_curve_to(cr, a[0], a[1], a[2], a[3], a[4], a[5]);
+        a += 6;
+        break;
+      case Op::Arc:
+        cairo_arc(cr, a[0], a[1], a[2], a[3], a[4]);
+        a += 5;
+        break;
+      case Op::Rect:
+        cairo_rectangle(cr, a[0], a[1], a[2], a[3]);
+        a += 4;
+        break;
+      case Op::ClosePath:
+        cairo_close_path(cr);
+        break;
+    }
+  }
+  cairo_identity_matrix(cr);
+  cairo_path_t* path = cairo_copy_path(cr);
+  cairo_destroy(cr);
+  cairo_surface_destroy(surface);
+  return path;
+}
+
+// static
+void Path::PlatformDestroy(NativePath path) {
+  cairo_path_destroy(path);
+}
+
+}  // namespace nu
@@ -4,9 +4,19 @@
 
 #include "nativeui/gfx/image.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
 #include "base/files/file_path.h"
 #include "base/strings/pattern.h"
 #include "base/strings/string_util.h"
+#include "nativeui/message_loop.h"
+#include "nativeui/state.h"
+#include "nativeui/util/worker_pool.h"
 
 namespace nu {
 
@@ -32,10 +42,77 @@ ScaleFactorPair kScaleFactorPairs[] = {
   { FILE_PATH_LITERAL("@2.5x")  , 2.5f },
 };
 
+#if defined(OS_LINUX)
+// GdkPixbuf can decode images on any thread.
+const bool kDecodeOnWorker = true;
+#else
+// NSImage needs autorelease pools and GDI+ images are not safe to share
+// between threads, keep them on the UI thread.
+const bool kDecodeOnWorker = false;
+#endif
+
+// Run |decode| and pass the result to |callback| on the UI thread.
+void DecodeAsync(std::function<scoped_refptr<Image>()> decode,
+                 Image::CreateCallback callback) {
+  if (!kDecodeOnWorker) {
+    MessageLoop::PostTask([decode, callback]() { callback(decode()); });
+    return;
+  }
+  State::GetCurrent()->GetWorkerPool()->PostTask(
+      [decode = std::move(decode), callback = std::move(callback)]() mutable {
+    // The worker holds the only reference until it is moved to the reply, so
+    // the image is released even if the reply never runs. The callback, which
+    // may hold references to script objects, must only be called on the UI
+    // thread.
+    scoped_refptr<Image> image = decode();
+    MessageLoop::PostTask(
+        [image = std::move(image), callback = std::move(callback)]() mutable {
+      callback(std::move(image));
+    });
+  });
+}
+
 }  // namespace
 
 Image::Image(NativeImage image) : image_(image) {}
 
+// static
+void Image::CreateFromPathAsync(const base::FilePath& path,
+                                CreateCallback callback) {
+  DecodeAsync([path]() { return new Image(path); }, std::move(callback));
+}
+
+// static
+void Image::CreateFromBufferAsync(const Buffer& buffer,
+                                  float scale_factor,
+                                  CreateCallback callback) {
+  // Buffers from language bindings are only valid during the call, so copy
+  // the content.
+  void* content = malloc(buffer.size());
+  memcpy(content, buffer.content(), buffer.size());
+  auto copy = std::make_shared<Buffer>(
+      Buffer::TakeOver(content, buffer.size(), free));
+  DecodeAsync([copy, scale_factor]() { return new Image(*copy, scale_factor); },
+              std::move(callback));
+}
+
+// static
+Size Image::GetDecodeSize(const Size& pixel_size,
+                          const SizeF& max_size,
+                          float scale_factor) {
+  if (pixel_size.IsEmpty())
+    return pixel_size;
+  float max_width = max_size.width() * scale_factor;
+  float max_height = max_size.height() * scale_factor;
+  if (pixel_size.width() <= max_width && pixel_size.height() <= max_height)
+    return pixel_size;
+  float scale = std::min(max_width / pixel_size.width(),
+                         max_height / pixel_size.height());
+  // Do not produce empty images for tiny sizes.
+  return Size(std::max(1, static_cast<int>(pixel_size.width() * scale)),
+              std::max(1, static_cast<int>(pixel_size.height() * scale)));
+}
+
 // static
 float Image::GetScaleFactorFromFilePath(const base::FilePath& path) {
   base::FilePath::StringType name(path.BaseName().RemoveExtension().value());
@@ -5,13 +5,19 @@
 #ifndef NATIVEUI_GFX_IMAGE_H_
 #define NATIVEUI_GFX_IMAGE_H_
 
+#include <stdint.h>
+
+#include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/files/file_path.h"
 #include "base/memory/ref_counted.h"
 #include "nativeui/buffer.h"
+#include "nativeui/gfx/geometry/size.h"
 #include "nativeui/gfx/geometry/size_f.h"
+#include "nativeui/gfx/pixel_format.h"
 #include "nativeui/types.h"
 
 #if defined(OS_WIN)
@@ -43,6 +49,29 @@ class NATIVEUI_EXPORT Image : public base::RefCounted<Image> {
   // Create an image from memory.
   Image(const Buffer& buffer, float scale_factor);
 
+  // Create an image by copying raw pixels of |size| from memory, which saves
+  // the encoding and decoding when pixels are generated by code.
+  Image(const Buffer& pixels,
+        const Size& size,
+        int stride,
+        PixelFormat format,
+        float scale_factor);
+
+  // Create an image by reading from |path|, and decode it at a resolution
+  // that fits in |max_size| DIP, which is much cheaper than loading the full
+  // image and scaling it when painting.
+  // The image is never scaled up, and the aspect ratio is kept.
+  Image(const base::FilePath& path, const SizeF& max_size);
+
+  // Create an image without blocking, the image is decoded on a background
+  // thread and passed to |callback| on the UI thread.
+  using CreateCallback = std::function<void(scoped_refptr<Image>)>;
+  static void CreateFromPathAsync(const base::FilePath& path,
+                                  CreateCallback callback);
+  static void CreateFromBufferAsync(const Buffer& buffer,
+                                    float scale_factor,
+                                    CreateCallback callback);
+
   // Whether the image is empty.
   bool IsEmpty() const;
 
@@ -61,6 +90,16 @@ class NATIVEUI_EXPORT Image : public base::RefCounted<Image> {
   // Return the native instance of image object.
   NativeImage GetNative() const { return image_; }
 
+  // Internal: Return the bytes used by decoded pixels, including all frames of
+  // animations and the surfaces cached for painting.
+  size_t GetMemorySize() const;
+
+  // Internal: Return the size in pixels to decode an image of |pixel_size|
+  // at, so it fits in |max_size| DIP.
+  static Size GetDecodeSize(const Size& pixel_size,
+                            const SizeF& max_size,
+                            float scale_factor);
+
 #if defined(OS_WIN)
   base::win::ScopedHICON GetHICON(const SizeF& size) const;
 #endif
@@ -74,11 +113,24 @@ class NATIVEUI_EXPORT Image : public base::RefCounted<Image> {
 #endif
 
 #if defined(OS_LINUX)
-  // Internal: Advance the frame iter.
+  // Internal: Advance to the frame that should be shown now.
   void AdvanceFrame();
 
-  // Internal: Return current animation frame.
-  GdkPixbufAnimationIter* iter() const { return iter_; }
+  // Internal: Return milliseconds until next frame, or -1 if the animation
+  // has ended.
+  int GetFrameDelay() const;
+
+  // Internal: Return the pixbuf of current frame, only meaningful when frames
+  // are not pre-rendered.
+  GdkPixbuf* GetFrame() const;
+
+  // Internal: Return a premultiplied cairo surface of current frame, the
+  // surface is cached and owned by the image.
+  cairo_surface_t* GetCairoSurface() const;
+
+  // Internal: Return the cairo surface of current frame scaled to
+  // |pixel_size|, the surface is cached and owned by the image.
+  cairo_surface_t* GetScaledCairoSurface(const Size& pixel_size) const;
 #endif
 
  protected:
@@ -97,6 +149,48 @@ class NATIVEUI_EXPORT Image : public base::RefCounted<Image> {
   bool is_empty_ = false;
   // The animation frame.
   GdkPixbufAnimationIter* iter_ = nullptr;
+
+  // Decode all frames of animation into |frames_| if they fit in memory.
+  void CacheFrames();
+
+  // Release cached surfaces.
+  void ClearCairoSurfaces() const;
+
+  // Return the delay of cached frame at |index|, taking the loop count into
+  // account.
+  int GetCachedFrameDelay(size_t index) const;
+
+  // Number of frames in GIF data, 0 for other formats.
+  int frames_count_ = 0;
+  // Number of times to play the animation, 0 for forever.
+  int loop_count_ = 0;
+  // Number of loops of cached frames that have been played.
+  int loops_played_ = 0;
+
+  // Pre-rendered animation frames, empty if the image is not animated or too
+  // large to cache, in which case frames are decoded by |iter_| on demand.
+  struct Frame {
+    cairo_surface_t* surface;
+    int delay;  // milliseconds, -1 for a frame that never ends
+  };
+  bool frames_cached_ = false;
+  std::vector<Frame> frames_;
+  size_t frames_bytes_ = 0;
+  int frames_duration_ = 0;
+  size_t frame_index_ = 0;
+  int64_t frame_deadline_ = 0;
+  // Lazily scaled copies of |frames_| for |scaled_frames_size_|.
+  mutable Size scaled_frames_size_;
+  mutable std::vector<cairo_surface_t*> scaled_frames_;
+
+  // The frame that cached surfaces are created from.
+  mutable GdkPixbuf* surface_frame_ = nullptr;
+  mutable cairo_surface_t* surface_ = nullptr;
+  // Scaled variants of |surface_| keyed by pixel size, most recently used at
+  // the end.
+  mutable std::vector<std::pair<Size, cairo_surface_t*>> scaled_surfaces_;
+  // Bytes used by |surface_|, |scaled_surfaces_| and |scaled_frames_|.
+  mutable size_t surfaces_bytes_ = 0;
 #elif defined(OS_MACOSX)
   // The frame durations.
   std::vector<float> durations_;
@@ -0,0 +1,132 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/image_cache.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+#include "nativeui/state.h"
+
+namespace nu {
+
+namespace {
+
+// Default memory budget, enough for hundreds of icons.
+const uint32_t kDefaultMemoryBudget = 64 * 1024 * 1024;
+
+// 64-bit FNV-1a, the hash is used as identity of buffers so collisions must be
+// very unlikely.
+uint64_t HashBuffer(const Buffer& buffer) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  const uint8_t* content = static_cast<const uint8_t*>(buffer.content());
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    hash ^= content[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+}  // namespace
+
+bool ImageCache::Key::operator<(const Key& other) const {
+  float width = max_size.width();
+  float height = max_size.height();
+  float other_width = other.max_size.width();
+  float other_height = other.max_size.height();
+  return std::tie(source, path, hash, size, scale_factor, width, height) <
+         std::tie(other.source, other.path, other.hash, other.size,
+                  other.scale_factor, other_width, other_height);
+}
+
+// static
+ImageCache* ImageCache::GetCurrent() {
+  return State::GetCurrent()->GetImageCache();
+}
+
+ImageCache::ImageCache() : memory_budget_(kDefaultMemoryBudget) {}
+
+ImageCache::~ImageCache() {}
+
+scoped_refptr<Image> ImageCache::GetFromPath(const base::FilePath& path) {
+  Key key = {Key::Source::Path, path.value(), 0, 0, 1.f, SizeF()};
+  return Get(key, [&path]() { return new Image(path); });
+}
+
+scoped_refptr<Image> ImageCache::GetThumbnailFromPath(
+    const base::FilePath& path, const SizeF& max_size) {
+  Key key = {Key::Source::Path, path.value(), 0, 0, 1.f, max_size};
+  return Get(key, [&path, &max_size]() { return new Image(path, max_size); });
+}
+
+scoped_refptr<Image> ImageCache::GetFromBuffer(const Buffer& buffer,
+                                               float scale_factor) {
+  Key key = {Key::Source::Buffer, base::FilePath::StringType(),
+             HashBuffer(buffer), buffer.size(), scale_factor, SizeF()};
+  return Get(key, [&buffer, scale_factor]() {
+    return new Image(buffer, scale_factor);
+  });
+}
+
+void ImageCache::SetMemoryBudget(uint32_t bytes) {
+  memory_budget_ = bytes;
+  EvictUntil(memory_budget_);
+}
+
+void ImageCache::Clear() {
+  entries_.clear();
+  index_.clear();
+  memory_usage_ = 0;
+}
+
+// static
+uint32_t ImageCache::GetImageMemorySize(const Image* image) {
+  size_t bytes = image->GetMemorySize();
+  if (bytes > std::numeric_limits<uint32_t>::max())
+    return std::numeric_limits<uint32_t>::max();
+  return static_cast<uint32_t>(bytes);
+}
+
+template<typename Decode>
+scoped_refptr<Image> ImageCache::Get(const Key& key, const Decode& decode) {
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    ++hit_count_;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    // Images cache animation frames and surfaces when painted, so the memory
+    // usage changes after they are inserted.
+    Entry& entry = entries_.front();
+    uint32_t memory_size = GetImageMemorySize(entry.image.get());
+    memory_usage_ = memory_usage_ - entry.memory_size + memory_size;
+    entry.memory_size = memory_size;
+    scoped_refptr<Image> image = entry.image;
+    // Evict other images but keep the one being returned.
+    EvictUntil(std::max(memory_budget_, memory_size));
+    return image;
+  }
+  ++miss_count_;
+  scoped_refptr<Image> image = decode();
+  uint32_t memory_size = GetImageMemorySize(image.get());
+  // Do not cache failed reads so the file can be read again later, and do not
+  // let a single huge image flush the whole cache.
+  if (image->IsEmpty() || memory_size > memory_budget_)
+    return image;
+  EvictUntil(memory_budget_ - memory_size);
+  entries_.push_front({key, image, memory_size});
+  index_[key] = entries_.begin();
+  memory_usage_ += memory_size;
+  return image;
+}
+
+void ImageCache::EvictUntil(uint32_t memory_usage) {
+  while (memory_usage_ > memory_usage && !entries_.empty()) {
+    const Entry& entry = entries_.back();
+    memory_usage_ -= entry.memory_size;
+    index_.erase(entry.key);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace nu
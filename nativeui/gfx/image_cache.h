@@ -0,0 +1,99 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_IMAGE_CACHE_H_
+#define NATIVEUI_GFX_IMAGE_CACHE_H_
+
+#include <list>
+#include <map>
+
+#include "nativeui/gfx/image.h"
+
+namespace nu {
+
+// Cache of decoded images, so the same file or buffer is only decoded once.
+// This class is managed by State.
+class NATIVEUI_EXPORT ImageCache {
+ public:
+  ~ImageCache();
+
+  static ImageCache* GetCurrent();
+
+  // Return the image of |path|, decoding it on cache miss.
+  scoped_refptr<Image> GetFromPath(const base::FilePath& path);
+
+  // Return the image of |path| decoded to fit in |max_size|.
+  scoped_refptr<Image> GetThumbnailFromPath(const base::FilePath& path,
+                                            const SizeF& max_size);
+
+  // Return the image decoded from |buffer|, the buffer is identified by the
+  // hash of its content.
+  scoped_refptr<Image> GetFromBuffer(const Buffer& buffer, float scale_factor);
+
+  // Set the maximum bytes of decoded pixels kept by the cache, least recently
+  // used images are evicted first when exceeded.
+  void SetMemoryBudget(uint32_t bytes);
+  uint32_t GetMemoryBudget() const { return memory_budget_; }
+
+  // Return the bytes of decoded pixels kept by the cache.
+  uint32_t GetMemoryUsage() const { return memory_usage_; }
+
+  // Statistics of cache lookups.
+  uint32_t GetHitCount() const { return hit_count_; }
+  uint32_t GetMissCount() const { return miss_count_; }
+
+  // Remove all images from cache.
+  void Clear();
+
+  // Internal: Return the bytes used by decoded pixels of |image|.
+  static uint32_t GetImageMemorySize(const Image* image);
+
+ private:
+  friend class State;
+
+  // Decoded images identified by source, scale factor and requested size.
+  struct Key {
+    enum class Source { Path, Buffer };
+    Source source;
+    base::FilePath::StringType path;
+    uint64_t hash;
+    size_t size;
+    float scale_factor;
+    SizeF max_size;
+
+    bool operator<(const Key& other) const;
+  };
+
+  struct Entry {
+    Key key;
+    scoped_refptr<Image> image;
+    uint32_t memory_size;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  ImageCache();
+
+  template<typename Decode>
+  scoped_refptr<Image> Get(const Key& key, const Decode& decode);
+
+  // Remove least recently used images until the memory usage is no more than
+  // |memory_usage|.
+  void EvictUntil(uint32_t memory_usage);
+
+  // Most recently used images at the front.
+  EntryList entries_;
+  std::map<Key, EntryList::iterator> index_;
+
+  uint32_t memory_budget_;
+  uint32_t memory_usage_ = 0;
+  uint32_t hit_count_ = 0;
+  uint32_t miss_count_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(ImageCache);
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_IMAGE_CACHE_H_
@@ -0,0 +1,127 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/path_service.h"
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class ImageCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    cache_ = nu::ImageCache::GetCurrent();
+  }
+
+  base::FilePath GetFixture(const char* name) {
+    base::FilePath exe_path;
+    base::PathService::Get(base::FILE_EXE, &exe_path);
+    return exe_path.DirName().DirName().DirName()
+                   .Append(FILE_PATH_LITERAL("nativeui"))
+                   .Append(FILE_PATH_LITERAL("test"))
+                   .Append(FILE_PATH_LITERAL("fixtures"))
+                   .AppendASCII(name);
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  nu::ImageCache* cache_;
+};
+
+TEST_F(ImageCacheTest, GetFromPath) {
+  scoped_refptr<nu::Image> image =
+      cache_->GetFromPath(GetFixture("static.png"));
+  EXPECT_FALSE(image->IsEmpty());
+  EXPECT_EQ(cache_->GetMissCount(), 1u);
+  EXPECT_EQ(cache_->GetHitCount(), 0u);
+  EXPECT_EQ(cache_->GetFromPath(GetFixture("static.png")), image);
+  EXPECT_EQ(cache_->GetMissCount(), 1u);
+  EXPECT_EQ(cache_->GetHitCount(), 1u);
+  EXPECT_EQ(cache_->GetMemoryUsage(), 4u);
+}
+
+TEST_F(ImageCacheTest, GetThumbnailFromPath) {
+  base::FilePath path = GetFixture("animated.gif");
+  scoped_refptr<nu::Image> image = cache_->GetFromPath(path);
+  scoped_refptr<nu::Image> thumbnail =
+      cache_->GetThumbnailFromPath(path, nu::SizeF(5, 5));
+  EXPECT_NE(image, thumbnail);
+  EXPECT_EQ(thumbnail->GetSize(), nu::SizeF(5, 5));
+  EXPECT_EQ(cache_->GetThumbnailFromPath(path, nu::SizeF(5, 5)), thumbnail);
+  EXPECT_EQ(cache_->GetMissCount(), 2u);
+  EXPECT_EQ(cache_->GetHitCount(), 1u);
+}
+
+TEST_F(ImageCacheTest, GetFromBuffer) {
+  std::string content;
+  ASSERT_TRUE(base::ReadFileToString(GetFixture("static.png"), &content));
+  std::string copy = content;
+  scoped_refptr<nu::Image> image = cache_->GetFromBuffer(
+      nu::Buffer::Wrap(content.data(), content.size()), 1);
+  EXPECT_FALSE(image->IsEmpty());
+  // Buffers with same content share the image.
+  EXPECT_EQ(cache_->GetFromBuffer(
+                nu::Buffer::Wrap(copy.data(), copy.size()), 1), image);
+  // Scale factor is part of the key.
+  EXPECT_NE(cache_->GetFromBuffer(
+                nu::Buffer::Wrap(copy.data(), copy.size()), 2), image);
+  EXPECT_EQ(cache_->GetMissCount(), 2u);
+  EXPECT_EQ(cache_->GetHitCount(), 1u);
+}
+
+TEST_F(ImageCacheTest, EvictLeastRecentlyUsed) {
+  scoped_refptr<nu::Image> image1 = cache_->GetFromPath(
+      GetFixture("static.png"));
+  scoped_refptr<nu::Image> image2 = cache_->GetFromPath(
+      GetFixture("animated.gif"));
+  uint32_t size1 = nu::ImageCache::GetImageMemorySize(image1.get());
+  uint32_t size2 = nu::ImageCache::GetImageMemorySize(image2.get());
+  EXPECT_EQ(cache_->GetMemoryUsage(), size1 + size2);
+  // Make static.png most recently used.
+  cache_->GetFromPath(GetFixture("static.png"));
+  // Decrease the budget, the least recently used image is evicted.
+  cache_->SetMemoryBudget(size2 - 1);
+  EXPECT_EQ(cache_->GetMemoryUsage(), size1);
+  EXPECT_EQ(cache_->GetFromPath(GetFixture("static.png")), image1);
+  EXPECT_NE(cache_->GetFromPath(GetFixture("animated.gif")), image2);
+  // Images larger than budget are not cached.
+  EXPECT_EQ(cache_->GetMemoryUsage(), size1);
+}
+
+TEST_F(ImageCacheTest, CountAnimationFrames) {
+  scoped_refptr<nu::Image> image = cache_->GetFromPath(
+      GetFixture("animated.gif"));
+  // The 10x10 GIF has many frames.
+  EXPECT_GT(nu::ImageCache::GetImageMemorySize(image.get()), 10u * 10 * 4);
+  EXPECT_EQ(cache_->GetMemoryUsage(),
+            nu::ImageCache::GetImageMemorySize(image.get()));
+}
+
+TEST_F(ImageCacheTest, UpdateMemoryUsageAfterPainting) {
+  scoped_refptr<nu::Image> image = cache_->GetFromPath(
+      GetFixture("static.png"));
+  // Painting may cache surfaces in the image.
+  scoped_refptr<nu::Canvas> canvas = new nu::Canvas(nu::SizeF(4, 4), 2);
+  canvas->GetPainter()->DrawImage(image.get(), nu::RectF(0, 0, 4, 4));
+  EXPECT_EQ(cache_->GetFromPath(GetFixture("static.png")), image);
+  EXPECT_EQ(cache_->GetMemoryUsage(),
+            nu::ImageCache::GetImageMemorySize(image.get()));
+}
+
+TEST_F(ImageCacheTest, DoNotCacheFailedReads) {
+  scoped_refptr<nu::Image> image = cache_->GetFromPath(GetFixture("invalid"));
+  EXPECT_TRUE(image->IsEmpty());
+  EXPECT_NE(cache_->GetFromPath(GetFixture("invalid")), image);
+  EXPECT_EQ(cache_->GetMissCount(), 2u);
+}
+
+TEST_F(ImageCacheTest, Clear) {
+  scoped_refptr<nu::Image> image =
+      cache_->GetFromPath(GetFixture("static.png"));
+  cache_->Clear();
+  EXPECT_EQ(cache_->GetMemoryUsage(), 0u);
+  EXPECT_NE(cache_->GetFromPath(GetFixture("static.png")), image);
+}
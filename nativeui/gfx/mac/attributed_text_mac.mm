@@ -64,7 +64,7 @@ void AttributedText::PlatformSetColorFor(Color color, int start, int end) {
   [text_ endEditing];
 }
 
-RectF AttributedText::GetBoundsFor(const SizeF& size) const {
+RectF AttributedText::PlatformGetBoundsFor(const SizeF& size) const {
   int draw_options = 0;
   if (format_.wrap)
     draw_options |= NSStringDrawingUsesLineFragmentOrigin;
@@ -83,7 +83,7 @@ RectF AttributedText::GetBoundsFor(const SizeF& size) const {
   }
 }
 
-void AttributedText::SetText(const std::string& text) {
+void AttributedText::PlatformSetText(const std::string& text) {
   [[text_ mutableString] setString:base::SysUTF8ToNSString(text)];
 }
 
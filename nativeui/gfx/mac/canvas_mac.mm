@@ -39,4 +39,19 @@ Painter* Canvas::PlatformCreatePainter(NativeBitmap bitmap,
   return new PainterMac(bitmap, size, scale_factor);
 }
 
+// static
+Canvas::Pixels Canvas::PlatformLockPixels(NativeBitmap bitmap) {
+  CGContextFlush(bitmap);
+  int stride = CGBitmapContextGetBytesPerRow(bitmap);
+  Size size(CGBitmapContextGetWidth(bitmap),
+            CGBitmapContextGetHeight(bitmap));
+  return {Buffer::Wrap(CGBitmapContextGetData(bitmap), stride * size.height()),
+          size, stride, PixelFormat::ARGB32Premultiplied};
+}
+
+// static
+void Canvas::PlatformUnlockPixels(NativeBitmap bitmap) {
+  // Bitmap contexts draw from the memory directly.
+}
+
 }  // namespace nu
@@ -6,6 +6,8 @@
 
 #import <Cocoa/Cocoa.h>
 
+#include <algorithm>
+
 #include "base/mac/scoped_cftyperef.h"
 #include "base/strings/pattern.h"
 #include "base/strings/sys_string_conversions.h"
@@ -35,6 +37,11 @@ std::vector<float> GetFrameDurations(NSBitmapImageRep* bitmap,
   return durations;
 }
 
+bool IsTemplateImage(const base::FilePath& p) {
+  return base::MatchPattern(p.value(), "*Template.*") ||
+         base::MatchPattern(p.value(), "*Template@*x.*");
+}
+
 }  // namespace
 
 Image::Image() : image_([[NSImage alloc] init]) {}
@@ -71,10 +78,90 @@ Image::Image(const base::FilePath& p)
     durations_ = GetFrameDurations(rep, source);
   }
   // Is template image.
-  if (base::MatchPattern(p.value(), "*Template.*") ||
-      base::MatchPattern(p.value(), "*Template@*x.*")) {
+  if (IsTemplateImage(p))
     [image_ setTemplate:YES];
+}
+
+Image::Image(const Buffer& pixels,
+             const Size& size,
+             int stride,
+             PixelFormat format,
+             float scale_factor)
+    : scale_factor_(scale_factor), image_(nullptr) {
+  if (IsValidPixelBuffer(size, stride, pixels.size())) {
+    // CGImage reads all the formats directly.
+    CGBitmapInfo info;
+    switch (format) {
+      case PixelFormat::ARGB32:
+        info = kCGImageAlphaFirst | kCGBitmapByteOrder32Host;
+        break;
+      case PixelFormat::ARGB32Premultiplied:
+        info = kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Host;
+        break;
+      case PixelFormat::RGBA:
+        info = kCGImageAlphaLast | kCGBitmapByteOrderDefault;
+        break;
+    }
+    base::ScopedCFTypeRef<CFDataRef> data(CFDataCreate(
+        nullptr, static_cast<const UInt8*>(pixels.content()),
+        stride * size.height()));
+    base::ScopedCFTypeRef<CGDataProviderRef> provider(
+        CGDataProviderCreateWithCFData(data));
+    base::ScopedCFTypeRef<CGColorSpaceRef> color_space(
+        CGColorSpaceCreateDeviceRGB());
+    base::ScopedCFTypeRef<CGImageRef> image(CGImageCreate(
+        size.width(), size.height(), 8, 32, stride, color_space, info,
+        provider, nullptr, false, kCGRenderingIntentDefault));
+    if (image) {
+      image_ = [[NSImage alloc]
+          initWithCGImage:image
+                     size:NSMakeSize(size.width() / scale_factor,
+                                     size.height() / scale_factor)];
+    }
+  }
+  if (!image_)
+    image_ = [[NSImage alloc] init];
+}
+
+Image::Image(const base::FilePath& p, const SizeF& max_size)
+    : scale_factor_(GetScaleFactorFromFilePath(p)), image_(nullptr) {
+  NSString* u = base::SysUTF8ToNSString(p.value());
+  base::ScopedCFTypeRef<CGImageSourceRef> source(
+      CGImageSourceCreateWithURL((__bridge CFURLRef)[NSURL fileURLWithPath:u],
+                                 nullptr));
+  base::ScopedCFTypeRef<CFDictionaryRef> properties;
+  if (source)
+    properties.reset(CGImageSourceCopyPropertiesAtIndex(source, 0, nullptr));
+  if (properties) {
+    NSDictionary* dict = (__bridge NSDictionary*)properties.get();
+    Size size(
+        [[dict objectForKey:(__bridge NSString*)kCGImagePropertyPixelWidth]
+            intValue],
+        [[dict objectForKey:(__bridge NSString*)kCGImagePropertyPixelHeight]
+            intValue]);
+    Size decode_size = GetDecodeSize(size, max_size, scale_factor_);
+    // ImageIO decodes the thumbnail directly at the requested size.
+    NSDictionary* options = @{
+      (__bridge NSString*)kCGImageSourceCreateThumbnailFromImageAlways: @YES,
+      (__bridge NSString*)kCGImageSourceCreateThumbnailWithTransform: @YES,
+      (__bridge NSString*)kCGImageSourceThumbnailMaxPixelSize:
+          @(std::max(decode_size.width(), decode_size.height())),
+    };
+    base::ScopedCFTypeRef<CGImageRef> thumbnail(
+        CGImageSourceCreateThumbnailAtIndex(
+            source, 0, (__bridge CFDictionaryRef)options));
+    if (thumbnail) {
+      image_ = [[NSImage alloc]
+          initWithCGImage:thumbnail
+                     size:NSMakeSize(
+                              CGImageGetWidth(thumbnail) / scale_factor_,
+                              CGImageGetHeight(thumbnail) / scale_factor_)];
+    }
   }
+  if (!image_)
+    image_ = [[NSImage alloc] init];
+  if (IsTemplateImage(p))
+    [image_ setTemplate:YES];
 }
 
 Image::Image(const Buffer& buffer, float scale_factor)
@@ -113,6 +200,22 @@ SizeF Image::GetSize() const {
   return SizeF([image_ size]);
 }
 
+size_t Image::GetMemorySize() const {
+  size_t bytes = 0;
+  for (NSImageRep* rep in [image_ representations]) {
+    size_t frames_count = 1;
+    if ([rep isKindOfClass:[NSBitmapImageRep class]]) {
+      NSNumber* frames = [static_cast<NSBitmapImageRep*>(rep)
+          valueForProperty:NSImageFrameCount];
+      if (frames && [frames intValue] > 1)
+        frames_count = [frames intValue];
+    }
+    bytes += static_cast<size_t>(std::max<NSInteger>([rep pixelsWide], 0)) *
+             std::max<NSInteger>([rep pixelsHigh], 0) * 4 * frames_count;
+  }
+  return bytes;
+}
+
 NSBitmapImageRep* Image::GetAnimationRep() const {
   for (NSBitmapImageRep* rep in [image_ representations]) {
     if (![rep isKindOfClass:[NSBitmapImageRep class]])
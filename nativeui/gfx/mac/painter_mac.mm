@@ -13,6 +13,7 @@
 #include "nativeui/gfx/canvas.h"
 #include "nativeui/gfx/font.h"
 #include "nativeui/gfx/image.h"
+#include "nativeui/gfx/path.h"
 
 namespace nu {
 
@@ -163,6 +164,18 @@ void PainterMac::Fill() {
   CGContextFillPath(context_);
 }
 
+void PainterMac::StrokePath(const Path* path) {
+  CGContextBeginPath(context_);
+  CGContextAddPath(context_, path->GetNative());
+  CGContextStrokePath(context_);
+}
+
+void PainterMac::FillPath(const Path* path) {
+  CGContextBeginPath(context_);
+  CGContextAddPath(context_, path->GetNative());
+  CGContextFillPath(context_);
+}
+
 void PainterMac::Clear() {
   CGContextClearRect(context_, RectF(size_).ToCGRect());
 }
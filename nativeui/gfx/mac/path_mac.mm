@@ -0,0 +1,54 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/path.h"
+
+#import <Cocoa/Cocoa.h>
+
+namespace nu {
+
+NativePath Path::PlatformCreate() const {
+  CGAffineTransform t = CGAffineTransformMake(
+      matrix_[0], matrix_[1], matrix_[2], matrix_[3], matrix_[4], matrix_[5]);
+  CGMutablePathRef path = CGPathCreateMutable();
+  const float* a = args_.data();
+  for (Op op : ops_) {
+    switch (op) {
+      case Op::MoveTo:
+        CGPathMoveToPoint(path, &t, a[0], a[1]);
+        a += 2;
+        break;
+      case Op::LineTo:
+        CGPathAddLineToPoint(path, &t, a[0], a[1]);
+        a += 2;
+        break;
+      case Op::BezierCurveTo:
+        CGPathAddCurveToPoint(path, &t, a[0], a[1], a[2], a[3], a[4], a[5]);
+        a += 6;
+        break;
+      case Op::Arc:
+        // Same with PainterMac, we are in a flipped coordianate system.
+        CGPathAddArc(path, &t, a[0], a[1], a[2], a[3], a[4], false);
+        a += 5;
+        break;
+      case Op::Rect:
+        CGPathAddRect(path, &t, CGRectMake(a[0], a[1], a[2], a[3]));
+        a += 4;
+        break;
+      case Op::ClosePath:
+        // CoreGraphics complains when closing an empty path.
+        if (!CGPathIsEmpty(path))
+          CGPathCloseSubpath(path);
+        break;
+    }
+  }
+  return path;
+}
+
+// static
+void Path::PlatformDestroy(NativePath path) {
+  CGPathRelease(path);
+}
+
+}  // namespace nu
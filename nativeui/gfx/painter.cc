@@ -4,17 +4,118 @@
 
 #include "nativeui/gfx/painter.h"
 
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <string.h>
+
+#include <vector>
+
 #include "nativeui/gfx/attributed_text.h"
+#include "nativeui/gfx/recording.h"
+#include "nativeui/gfx/text_layout_cache.h"
 
 namespace nu {
 
+namespace {
+
+// Call |draw| with the primitives packed in |data|, each of them takes |N|
+// floats.
+template<size_t N, typename... Args>
+void DrawPacked(Painter* painter,
+                void (Painter::*draw)(const float*, size_t, Args...),
+                const void* data,
+                size_t bytes,
+                Args... args) {
+  size_t count = bytes / (N * sizeof(float));
+  const float* floats = static_cast<const float*>(data);
+  std::vector<float> copy;
+  if (reinterpret_cast<uintptr_t>(data) % alignof(float) != 0) {
+    copy.resize(count * N);
+    memcpy(copy.data(), data, copy.size() * sizeof(float));
+    floats = copy.data();
+  }
+  (painter->*draw)(floats, count, args...);
+}
+
+}  // namespace
+
 Painter::Painter() : weak_factory_(this) {}
 
 Painter::~Painter() {}
 
 void Painter::DrawText(const std::string& str, const RectF& rect,
                        const TextAttributes& attributes) {
-  DrawAttributedText(new AttributedText(str, attributes), rect);
+  // Reuse the layout of same text so it is not shaped again on every repaint,
+  // the size of |rect| is applied to the layout when drawing.
+  DrawAttributedText(TextLayoutCache::GetCurrent()->Get(str, attributes), rect);
+}
+
+void Painter::FillRects(const float* rects, size_t count) {
+  // Add all shapes to one path so they are filled with one native call.
+  BeginPath();
+  for (size_t i = 0; i < count; ++i, rects += 4)
+    Rect(RectF(rects[0], rects[1], rects[2], rects[3]));
+  Fill();
+}
+
+void Painter::StrokeRects(const float* rects, size_t count) {
+  BeginPath();
+  for (size_t i = 0; i < count; ++i, rects += 4)
+    Rect(RectF(rects[0], rects[1], rects[2], rects[3]));
+  Stroke();
+}
+
+void Painter::DrawPolyline(const float* points, size_t count) {
+  BeginPath();
+  if (count > 0)
+    MoveTo(PointF(points[0], points[1]));
+  for (size_t i = 1; i < count; ++i)
+    LineTo(PointF(points[i * 2], points[i * 2 + 1]));
+  Stroke();
+}
+
+void Painter::DrawPoints(const float* points, size_t count, float size) {
+  BeginPath();
+  for (size_t i = 0; i < count; ++i, points += 2)
+    Rect(RectF(points[0] - size / 2, points[1] - size / 2, size, size));
+  Fill();
+}
+
+void Painter::FillCircles(const float* circles, size_t count) {
+  BeginPath();
+  for (size_t i = 0; i < count; ++i, circles += 3) {
+    // Start a new sub-path so circles are not connected by lines.
+    MoveTo(PointF(circles[0] + circles[2], circles[1]));
+    Arc(PointF(circles[0], circles[1]), circles[2], 0,
+        2 * static_cast<float>(M_PI));
+  }
+  Fill();
+}
+
+void Painter::FillRects(const void* rects, size_t bytes) {
+  DrawPacked<4>(this, &Painter::FillRects, rects, bytes);
+}
+
+void Painter::StrokeRects(const void* rects, size_t bytes) {
+  DrawPacked<4>(this, &Painter::StrokeRects, rects, bytes);
+}
+
+void Painter::DrawPolyline(const void* points, size_t bytes) {
+  DrawPacked<2>(this, &Painter::DrawPolyline, points, bytes);
+}
+
+void Painter::DrawPoints(const void* points, size_t bytes, float size) {
+  DrawPacked<2>(this, &Painter::DrawPoints, points, bytes, size);
+}
+
+void Painter::FillCircles(const void* circles, size_t bytes) {
+  DrawPacked<3>(this, &Painter::FillCircles, circles, bytes);
+}
+
+void Painter::DrawRecording(const Recording* recording) {
+  Save();
+  recording->Replay(this);
+  Restore();
 }
 
 }  // namespace nu
@@ -22,6 +22,8 @@ namespace nu {
 class AttributedText;
 class Canvas;
 class Image;
+class Path;
+class Recording;
 
 // The interface for painting on canvas or window.
 class NATIVEUI_EXPORT Painter {
@@ -68,6 +70,10 @@ class NATIVEUI_EXPORT Painter {
   // Draw a solid shape by filling current path's content area.
   virtual void Fill() = 0;
 
+  // Stroke or fill a prebuilt |path|, current path is discarded.
+  virtual void StrokePath(const Path* path) = 0;
+  virtual void FillPath(const Path* path) = 0;
+
   // Fill the whole context with transparent color.
   virtual void Clear() = 0;
 
@@ -77,6 +83,27 @@ class NATIVEUI_EXPORT Painter {
   // Fill |rect|.
   virtual void FillRect(const RectF& rect) = 0;
 
+  // Draw |count| primitives packed in a float array with one call, current
+  // path is discarded.
+  // Fill rects packed as (x, y, width, height).
+  virtual void FillRects(const float* rects, size_t count);
+  // Stroke rects packed as (x, y, width, height).
+  virtual void StrokeRects(const float* rects, size_t count);
+  // Stroke lines connecting points packed as (x, y).
+  virtual void DrawPolyline(const float* points, size_t count);
+  // Fill squares of |size| centered at points packed as (x, y).
+  virtual void DrawPoints(const float* points, size_t count, float size);
+  // Fill circles packed as (x, y, radius).
+  virtual void FillCircles(const float* circles, size_t count);
+
+  // Same with above but take |bytes| of packed floats that do not have to be
+  // aligned, e.g. buffers passed from language bindings.
+  void FillRects(const void* rects, size_t bytes);
+  void StrokeRects(const void* rects, size_t bytes);
+  void DrawPolyline(const void* points, size_t bytes);
+  void DrawPoints(const void* points, size_t bytes, float size);
+  void FillCircles(const void* circles, size_t bytes);
+
   // Draw image.
   virtual void DrawImage(const Image* image, const RectF& rect) = 0;
   virtual void DrawImageFromRect(const Image* image, const RectF& src,
@@ -95,6 +122,9 @@ class NATIVEUI_EXPORT Painter {
   virtual void DrawText(const std::string& text, const RectF& rect,
                         const TextAttributes& attributes);
 
+  // Run the operations of |recording|, the state of painter is kept.
+  virtual void DrawRecording(const Recording* recording);
+
   base::WeakPtr<Painter> GetWeakPtr() { return weak_factory_.GetWeakPtr(); }
 
  protected:
@@ -0,0 +1,176 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/painter_recorder.h"
+
+#include <utility>
+
+#include "nativeui/gfx/attributed_text.h"
+#include "nativeui/gfx/canvas.h"
+#include "nativeui/gfx/image.h"
+#include "nativeui/gfx/path.h"
+
+namespace nu {
+
+PainterRecorder::PainterRecorder(Recording* recording)
+    : recording_(recording) {}
+
+PainterRecorder::~PainterRecorder() {}
+
+void PainterRecorder::Save() {
+  Record(Op::Save);
+}
+
+void PainterRecorder::Restore() {
+  Record(Op::Restore);
+}
+
+void PainterRecorder::BeginPath() {
+  Record(Op::BeginPath);
+}
+
+void PainterRecorder::ClosePath() {
+  Record(Op::ClosePath);
+}
+
+void PainterRecorder::MoveTo(const PointF& point) {
+  Record(Op::MoveTo, {point.x(), point.y()});
+}
+
+void PainterRecorder::LineTo(const PointF& point) {
+  Record(Op::LineTo, {point.x(), point.y()});
+}
+
+void PainterRecorder::BezierCurveTo(const PointF& cp1,
+                                    const PointF& cp2,
+                                    const PointF& ep) {
+  Record(Op::BezierCurveTo,
+         {cp1.x(), cp1.y(), cp2.x(), cp2.y(), ep.x(), ep.y()});
+}
+
+void PainterRecorder::Arc(const PointF& point, float radius,
+                          float sa, float ea) {
+  Record(Op::Arc, {point.x(), point.y(), radius, sa, ea});
+}
+
+void PainterRecorder::Rect(const RectF& rect) {
+  Record(Op::Rect, {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void PainterRecorder::Clip() {
+  Record(Op::Clip);
+}
+
+void PainterRecorder::ClipRect(const RectF& rect) {
+  Record(Op::ClipRect, {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void PainterRecorder::Translate(const Vector2dF& offset) {
+  Record(Op::Translate, {offset.x(), offset.y()});
+}
+
+void PainterRecorder::Rotate(float angle) {
+  Record(Op::Rotate, {angle});
+}
+
+void PainterRecorder::Scale(const Vector2dF& scale) {
+  Record(Op::Scale, {scale.x(), scale.y()});
+}
+
+void PainterRecorder::SetColor(Color color) {
+  recording_->colors_.push_back(color);
+  Record(Op::SetColor);
+}
+
+void PainterRecorder::SetStrokeColor(Color color) {
+  recording_->colors_.push_back(color);
+  Record(Op::SetStrokeColor);
+}
+
+void PainterRecorder::SetFillColor(Color color) {
+  recording_->colors_.push_back(color);
+  Record(Op::SetFillColor);
+}
+
+void PainterRecorder::SetLineWidth(float width) {
+  Record(Op::SetLineWidth, {width});
+}
+
+void PainterRecorder::Stroke() {
+  Record(Op::Stroke);
+}
+
+void PainterRecorder::Fill() {
+  Record(Op::Fill);
+}
+
+void PainterRecorder::StrokePath(const Path* path) {
+  recording_->paths_.push_back(path);
+  Record(Op::StrokePath);
+}
+
+void PainterRecorder::FillPath(const Path* path) {
+  recording_->paths_.push_back(path);
+  Record(Op::FillPath);
+}
+
+void PainterRecorder::Clear() {
+  Record(Op::Clear);
+}
+
+void PainterRecorder::StrokeRect(const RectF& rect) {
+  Record(Op::StrokeRect, {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void PainterRecorder::FillRect(const RectF& rect) {
+  Record(Op::FillRect, {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void PainterRecorder::DrawImage(const Image* image, const RectF& rect) {
+  recording_->images_.push_back(image);
+  Record(Op::DrawImage, {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void PainterRecorder::DrawImageFromRect(const Image* image, const RectF& src,
+                                        const RectF& dest) {
+  recording_->images_.push_back(image);
+  Record(Op::DrawImageFromRect,
+         {src.x(), src.y(), src.width(), src.height(),
+          dest.x(), dest.y(), dest.width(), dest.height()});
+}
+
+void PainterRecorder::DrawCanvas(Canvas* canvas, const RectF& rect) {
+  recording_->canvases_.push_back(canvas);
+  Record(Op::DrawCanvas, {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void PainterRecorder::DrawCanvasFromRect(Canvas* canvas, const RectF& src,
+                                         const RectF& dest) {
+  recording_->canvases_.push_back(canvas);
+  Record(Op::DrawCanvasFromRect,
+         {src.x(), src.y(), src.width(), src.height(),
+          dest.x(), dest.y(), dest.width(), dest.height()});
+}
+
+void PainterRecorder::DrawAttributedText(scoped_refptr<AttributedText> text,
+                                         const RectF& rect) {
+  recording_->texts_.push_back(std::move(text));
+  Record(Op::DrawAttributedText,
+         {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void PainterRecorder::DrawRecording(const Recording* recording) {
+  // Copy the operations instead of referencing, so recordings can not form
+  // cycles.
+  Save();
+  recording_->Append(recording);
+  Restore();
+}
+
+void PainterRecorder::Record(Op op, std::initializer_list<float> args) {
+  recording_->ops_.push_back(op);
+  recording_->args_.insert(recording_->args_.end(), args);
+}
+
+}  // namespace nu
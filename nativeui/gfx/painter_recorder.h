@@ -0,0 +1,71 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_PAINTER_RECORDER_H_
+#define NATIVEUI_GFX_PAINTER_RECORDER_H_
+
+#include <initializer_list>
+#include <string>
+
+#include "nativeui/gfx/painter.h"
+#include "nativeui/gfx/recording.h"
+
+namespace nu {
+
+// Painter that appends operations to a Recording instead of drawing.
+class PainterRecorder : public Painter {
+ public:
+  explicit PainterRecorder(Recording* recording);
+  ~PainterRecorder() override;
+
+  // Painter:
+  void Save() override;
+  void Restore() override;
+  void BeginPath() override;
+  void ClosePath() override;
+  void MoveTo(const PointF& point) override;
+  void LineTo(const PointF& point) override;
+  void BezierCurveTo(const PointF& cp1,
+                     const PointF& cp2,
+                     const PointF& ep) override;
+  void Arc(const PointF& point, float radius, float sa, float ea) override;
+  void Rect(const RectF& rect) override;
+  void Clip() override;
+  void ClipRect(const RectF& rect) override;
+  void Translate(const Vector2dF& offset) override;
+  void Rotate(float angle) override;
+  void Scale(const Vector2dF& scale) override;
+  void SetColor(Color color) override;
+  void SetStrokeColor(Color color) override;
+  void SetFillColor(Color color) override;
+  void SetLineWidth(float width) override;
+  void Stroke() override;
+  void Fill() override;
+  void StrokePath(const Path* path) override;
+  void FillPath(const Path* path) override;
+  void Clear() override;
+  void StrokeRect(const RectF& rect) override;
+  void FillRect(const RectF& rect) override;
+  void DrawImage(const Image* image, const RectF& rect) override;
+  void DrawImageFromRect(const Image* image, const RectF& src,
+                         const RectF& dest) override;
+  void DrawCanvas(Canvas* canvas, const RectF& rect) override;
+  void DrawCanvasFromRect(Canvas* canvas, const RectF& src,
+                          const RectF& dest) override;
+  void DrawAttributedText(scoped_refptr<AttributedText> text,
+                          const RectF& rect) override;
+  void DrawRecording(const Recording* recording) override;
+
+ private:
+  using Op = Recording::Op;
+
+  void Record(Op op, std::initializer_list<float> args = {});
+
+  // The recording owns this painter.
+  Recording* recording_;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_PAINTER_RECORDER_H_
@@ -0,0 +1,101 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/path.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+namespace nu {
+
+Path::Path() {}
+
+Path::~Path() {
+  Invalidate();
+}
+
+void Path::MoveTo(const PointF& point) {
+  AddOp(Op::MoveTo, {point.x(), point.y()});
+}
+
+void Path::LineTo(const PointF& point) {
+  AddOp(Op::LineTo, {point.x(), point.y()});
+}
+
+void Path::BezierCurveTo(const PointF& cp1,
+                         const PointF& cp2,
+                         const PointF& ep) {
+  AddOp(Op::BezierCurveTo,
+        {cp1.x(), cp1.y(), cp2.x(), cp2.y(), ep.x(), ep.y()});
+}
+
+void Path::Arc(const PointF& point, float radius, float sa, float ea) {
+  AddOp(Op::Arc, {point.x(), point.y(), radius, sa, ea});
+}
+
+void Path::Rect(const RectF& rect) {
+  AddOp(Op::Rect, {rect.x(), rect.y(), rect.width(), rect.height()});
+}
+
+void Path::ClosePath() {
+  AddOp(Op::ClosePath, {});
+}
+
+void Path::Translate(const Vector2dF& offset) {
+  Transform(1, 0, 0, 1, offset.x(), offset.y());
+}
+
+void Path::Rotate(float angle) {
+  float s = sinf(angle);
+  float c = cosf(angle);
+  Transform(c, s, -s, c, 0, 0);
+}
+
+void Path::Scale(const Vector2dF& scale) {
+  Transform(scale.x(), 0, 0, scale.y(), 0, 0);
+}
+
+void Path::Clear() {
+  Invalidate();
+  ops_.clear();
+  args_.clear();
+  const float identity[] = {1, 0, 0, 1, 0, 0};
+  std::copy(identity, identity + 6, matrix_);
+}
+
+NativePath Path::GetNative() const {
+  if (!native_)
+    native_ = PlatformCreate();
+  return native_;
+}
+
+void Path::AddOp(Op op, std::initializer_list<float> args) {
+  Invalidate();
+  ops_.push_back(op);
+  args_.insert(args_.end(), args);
+}
+
+void Path::Transform(float a, float b, float c, float d, float tx, float ty) {
+  Invalidate();
+  const float* m = matrix_;
+  float result[6] = {
+    a * m[0] + c * m[1],
+    b * m[0] + d * m[1],
+    a * m[2] + c * m[3],
+    b * m[2] + d * m[3],
+    a * m[4] + c * m[5] + tx,
+    b * m[4] + d * m[5] + ty,
+  };
+  std::copy(result, result + 6, matrix_);
+}
+
+void Path::Invalidate() {
+  if (native_) {
+    PlatformDestroy(native_);
+    native_ = nullptr;
+  }
+}
+
+}  // namespace nu
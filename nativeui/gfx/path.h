@@ -0,0 +1,91 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_PATH_H_
+#define NATIVEUI_GFX_PATH_H_
+
+#include <initializer_list>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "nativeui/gfx/geometry/rect_f.h"
+#include "nativeui/nativeui_export.h"
+#include "nativeui/types.h"
+
+namespace nu {
+
+// A path that is built once and can be filled or stroked by Painter many
+// times.
+class NATIVEUI_EXPORT Path : public base::RefCounted<Path> {
+ public:
+  Path();
+
+  // Add segments to the path.
+  void MoveTo(const PointF& point);
+  void LineTo(const PointF& point);
+  void BezierCurveTo(const PointF& cp1,
+                     const PointF& cp2,
+                     const PointF& ep);
+  void Arc(const PointF& point, float radius, float sa, float ea);
+  void Rect(const RectF& rect);
+  void ClosePath();
+
+  // Transform the whole path, transforms are applied to the shape in the
+  // order they are called.
+  void Translate(const Vector2dF& offset);
+  void Rotate(float angle);
+  void Scale(const Vector2dF& scale);
+
+  // Remove all segments and transforms.
+  void Clear();
+
+  // Return whether there is no segment.
+  bool IsEmpty() const { return ops_.empty(); }
+
+  // Internal: Return the native path, which is created on first use and kept
+  // until the path is changed.
+  NativePath GetNative() const;
+
+ protected:
+  virtual ~Path();
+
+ private:
+  friend class base::RefCounted<Path>;
+
+  enum class Op : uint8_t {
+    MoveTo,
+    LineTo,
+    BezierCurveTo,
+    Arc,
+    Rect,
+    ClosePath,
+  };
+
+  void AddOp(Op op, std::initializer_list<float> args);
+
+  // Multiply current transform by the matrix on the left.
+  void Transform(float a, float b, float c, float d, float tx, float ty);
+
+  // Free the native path so it is created again.
+  void Invalidate();
+
+  // Create the native path from segments and transform.
+  NativePath PlatformCreate() const;
+  static void PlatformDestroy(NativePath path);
+
+  std::vector<Op> ops_;
+  std::vector<float> args_;
+
+  // The transform in the form of {a, b, c, d, tx, ty}, which maps point
+  // (x, y) to (a * x + c * y + tx, b * x + d * y + ty).
+  float matrix_[6] = {1, 0, 0, 1, 0, 0};
+
+  mutable NativePath native_ = nullptr;
+
+  DISALLOW_COPY_AND_ASSIGN(Path);
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_PATH_H_
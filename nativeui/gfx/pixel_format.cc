@@ -0,0 +1,196 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/pixel_format.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#if defined(ARCH_CPU_X86_FAMILY)
+#include <emmintrin.h>
+#elif defined(ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#if !defined(ARCH_CPU_LITTLE_ENDIAN)
+#error "Pixel conversions assume little endian"
+#endif
+
+namespace nu {
+
+namespace {
+
+// On little endian the RGBA bytes read as a 32-bit integer is ABGR, so the
+// conversion between RGBA and ARGB32 is swapping red and blue.
+inline uint32_t SwapRedBlue(uint32_t p) {
+  return (p & 0xFF00FF00) | ((p >> 16) & 0xFF) | ((p & 0xFF) << 16);
+}
+
+// Compute c * a / 255 with rounding, the SIMD versions produce same results.
+inline uint32_t MultiplyAlpha(uint32_t c, uint32_t a) {
+  uint32_t t = c * a + 128;
+  return (t + (t >> 8)) >> 8;
+}
+
+inline uint32_t Premultiply(uint32_t p) {
+  uint32_t a = p >> 24;
+  return (a << 24) |
+         (MultiplyAlpha((p >> 16) & 0xFF, a) << 16) |
+         (MultiplyAlpha((p >> 8) & 0xFF, a) << 8) |
+         MultiplyAlpha(p & 0xFF, a);
+}
+
+inline uint32_t Unpremultiply(uint32_t p) {
+  uint32_t a = p >> 24;
+  if (a == 0)
+    return 0;
+  if (a == 255)
+    return p;
+  auto divide = [a](uint32_t c) {
+    return std::min<uint32_t>(255, (c * 255 + a / 2) / a);
+  };
+  return (a << 24) |
+         (divide((p >> 16) & 0xFF) << 16) |
+         (divide((p >> 8) & 0xFF) << 8) |
+         divide(p & 0xFF);
+}
+
+// Convert pixels in a row, which has no SIMD implementation.
+void ConvertRowScalar(const uint32_t* src, uint32_t* dst, int width,
+                      bool swap, bool premultiply, bool unpremultiply) {
+  for (int i = 0; i < width; ++i) {
+    uint32_t p = src[i];
+    if (unpremultiply)
+      p = Unpremultiply(p);
+    if (premultiply)
+      p = Premultiply(p);
+    if (swap)
+      p = SwapRedBlue(p);
+    dst[i] = p;
+  }
+}
+
+#if defined(ARCH_CPU_X86_FAMILY)
+// Process 4 pixels each time, SSE2 is always available on x64.
+int ConvertRowSIMD(const uint32_t* src, uint32_t* dst, int width,
+                   bool swap, bool premultiply) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i alpha_mask = _mm_set1_epi32(0xFF000000);
+  const __m128i ag_mask = _mm_set1_epi32(0xFF00FF00);
+  const __m128i rb_mask = _mm_set1_epi32(0x00FF00FF);
+  const __m128i round = _mm_set1_epi16(128);
+  int i = 0;
+  for (; i + 4 <= width; i += 4) {
+    __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    if (swap) {
+      __m128i rb = _mm_and_si128(p, rb_mask);
+      p = _mm_or_si128(_mm_and_si128(p, ag_mask),
+                       _mm_or_si128(_mm_slli_epi32(rb, 16),
+                                    _mm_srli_epi32(rb, 16)));
+    }
+    if (premultiply) {
+      __m128i lo = _mm_unpacklo_epi8(p, zero);
+      __m128i hi = _mm_unpackhi_epi8(p, zero);
+      // Broadcast alpha to all channels of each pixel.
+      __m128i lo_a = _mm_shufflehi_epi16(
+          _mm_shufflelo_epi16(lo, _MM_SHUFFLE(3, 3, 3, 3)),
+          _MM_SHUFFLE(3, 3, 3, 3));
+      __m128i hi_a = _mm_shufflehi_epi16(
+          _mm_shufflelo_epi16(hi, _MM_SHUFFLE(3, 3, 3, 3)),
+          _MM_SHUFFLE(3, 3, 3, 3));
+      lo = _mm_add_epi16(_mm_mullo_epi16(lo, lo_a), round);
+      hi = _mm_add_epi16(_mm_mullo_epi16(hi, hi_a), round);
+      lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+      hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+      // Keep the original alpha.
+      p = _mm_or_si128(_mm_andnot_si128(alpha_mask, _mm_packus_epi16(lo, hi)),
+                       _mm_and_si128(p, alpha_mask));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), p);
+  }
+  return i;
+}
+#elif defined(ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON)
+// Process 16 pixels each time with channels deinterleaved.
+inline uint8x16_t MultiplyAlpha(uint8x16_t c, uint8x16_t a) {
+  const uint16x8_t round = vdupq_n_u16(128);
+  uint16x8_t lo = vaddq_u16(vmull_u8(vget_low_u8(c), vget_low_u8(a)), round);
+  uint16x8_t hi = vaddq_u16(vmull_u8(vget_high_u8(c), vget_high_u8(a)),
+                            round);
+  return vcombine_u8(vshrn_n_u16(vaddq_u16(lo, vshrq_n_u16(lo, 8)), 8),
+                     vshrn_n_u16(vaddq_u16(hi, vshrq_n_u16(hi, 8)), 8));
+}
+
+int ConvertRowSIMD(const uint32_t* src, uint32_t* dst, int width,
+                   bool swap, bool premultiply) {
+  int i = 0;
+  for (; i + 16 <= width; i += 16) {
+    uint8x16x4_t p = vld4q_u8(reinterpret_cast<const uint8_t*>(src + i));
+    if (premultiply) {
+      p.val[0] = MultiplyAlpha(p.val[0], p.val[3]);
+      p.val[1] = MultiplyAlpha(p.val[1], p.val[3]);
+      p.val[2] = MultiplyAlpha(p.val[2], p.val[3]);
+    }
+    if (swap)
+      std::swap(p.val[0], p.val[2]);
+    vst4q_u8(reinterpret_cast<uint8_t*>(dst + i), p);
+  }
+  return i;
+}
+#else
+int ConvertRowSIMD(const uint32_t* src, uint32_t* dst, int width,
+                   bool swap, bool premultiply) {
+  return 0;
+}
+#endif
+
+bool IsPremultiplied(PixelFormat format) {
+  return format == PixelFormat::ARGB32Premultiplied;
+}
+
+}  // namespace
+
+bool IsValidPixelBuffer(const Size& size, int stride, size_t length) {
+  if (size.IsEmpty() || stride < size.width() * 4)
+    return false;
+  return length >= static_cast<size_t>(stride) * size.height();
+}
+
+void ConvertPixels(const Size& size,
+                   const void* src,
+                   int src_stride,
+                   PixelFormat src_format,
+                   void* dst,
+                   int dst_stride,
+                   PixelFormat dst_format) {
+  const uint8_t* src_row = static_cast<const uint8_t*>(src);
+  uint8_t* dst_row = static_cast<uint8_t*>(dst);
+  int width = size.width();
+  bool swap = (src_format == PixelFormat::RGBA) !=
+              (dst_format == PixelFormat::RGBA);
+  bool premultiply = !IsPremultiplied(src_format) &&
+                     IsPremultiplied(dst_format);
+  bool unpremultiply = IsPremultiplied(src_format) &&
+                       !IsPremultiplied(dst_format);
+  for (int y = 0; y < size.height(); ++y) {
+    const uint32_t* s = reinterpret_cast<const uint32_t*>(src_row);
+    uint32_t* d = reinterpret_cast<uint32_t*>(dst_row);
+    if (!swap && !premultiply && !unpremultiply) {
+      memcpy(d, s, width * 4);
+    } else {
+      // Dividing has no fast SIMD implementation, and it is rarely used.
+      int i = unpremultiply ? 0 : ConvertRowSIMD(s, d, width, swap,
+                                                 premultiply);
+      ConvertRowScalar(s + i, d + i, width - i,
+                       swap, premultiply, unpremultiply);
+    }
+    src_row += src_stride;
+    dst_row += dst_stride;
+  }
+}
+
+}  // namespace nu
@@ -0,0 +1,44 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_PIXEL_FORMAT_H_
+#define NATIVEUI_GFX_PIXEL_FORMAT_H_
+
+#include <stddef.h>
+
+#include "nativeui/gfx/geometry/size.h"
+#include "nativeui/nativeui_export.h"
+
+namespace nu {
+
+// Memory layout of pixels.
+enum class PixelFormat {
+  // Each pixel is a 32-bit native-endian integer, with alpha in the upper 8
+  // bits, then red, green and blue.
+  ARGB32,
+  // Same with ARGB32, but the colors are premultiplied by alpha.
+  ARGB32Premultiplied,
+  // Each pixel is 4 bytes of red, green, blue and alpha in order.
+  RGBA,
+};
+
+// Return whether a buffer of |length| bytes can hold pixels of |size| with
+// |stride| bytes per row.
+NATIVEUI_EXPORT bool IsValidPixelBuffer(const Size& size,
+                                        int stride,
+                                        size_t length);
+
+// Copy pixels of |size| from |src| to |dst| while converting the format, the
+// memory of |src| and |dst| must not overlap.
+NATIVEUI_EXPORT void ConvertPixels(const Size& size,
+                                   const void* src,
+                                   int src_stride,
+                                   PixelFormat src_format,
+                                   void* dst,
+                                   int dst_stride,
+                                   PixelFormat dst_format);
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_PIXEL_FORMAT_H_
@@ -0,0 +1,103 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "nativeui/gfx/pixel_format.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+// Width that covers both SIMD blocks and the remaining pixels.
+const int kWidth = 37;
+
+uint32_t ReadRGBA(const uint8_t* p) {
+  return (p[3] << 24) | (p[0] << 16) | (p[1] << 8) | p[2];
+}
+
+uint32_t Premultiply(uint32_t p) {
+  uint32_t a = p >> 24;
+  auto mul = [a](uint32_t c) { return (c * a + 127) / 255; };
+  return (a << 24) | (mul((p >> 16) & 0xFF) << 16) |
+         (mul((p >> 8) & 0xFF) << 8) | mul(p & 0xFF);
+}
+
+std::vector<uint8_t> CreateRGBA(int width, int height, int stride) {
+  std::vector<uint8_t> pixels(stride * height);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width * 4; ++x)
+      pixels[y * stride + x] = static_cast<uint8_t>((x * 37 + y * 101) & 0xFF);
+  }
+  return pixels;
+}
+
+}  // namespace
+
+TEST(PixelFormatTest, RGBAToARGB32) {
+  int stride = kWidth * 4 + 8;
+  std::vector<uint8_t> src = CreateRGBA(kWidth, 3, stride);
+  std::vector<uint32_t> dst(kWidth * 3);
+  nu::ConvertPixels(nu::Size(kWidth, 3), src.data(), stride,
+                    nu::PixelFormat::RGBA, dst.data(), kWidth * 4,
+                    nu::PixelFormat::ARGB32);
+  for (int y = 0; y < 3; ++y) {
+    for (int x = 0; x < kWidth; ++x)
+      ASSERT_EQ(dst[y * kWidth + x], ReadRGBA(&src[y * stride + x * 4]));
+  }
+}
+
+TEST(PixelFormatTest, RGBAToARGB32Premultiplied) {
+  int stride = kWidth * 4;
+  std::vector<uint8_t> src = CreateRGBA(kWidth, 3, stride);
+  std::vector<uint32_t> dst(kWidth * 3);
+  nu::ConvertPixels(nu::Size(kWidth, 3), src.data(), stride,
+                    nu::PixelFormat::RGBA, dst.data(), stride,
+                    nu::PixelFormat::ARGB32Premultiplied);
+  for (int i = 0; i < kWidth * 3; ++i)
+    ASSERT_EQ(dst[i], Premultiply(ReadRGBA(&src[i * 4])));
+}
+
+TEST(PixelFormatTest, PremultiplyAllValues) {
+  // Every pair of color and alpha.
+  std::vector<uint32_t> src(256 * 256);
+  for (uint32_t a = 0; a < 256; ++a) {
+    for (uint32_t c = 0; c < 256; ++c)
+      src[a * 256 + c] = (a << 24) | (c << 16) | (c << 8) | c;
+  }
+  std::vector<uint32_t> dst(src.size());
+  nu::ConvertPixels(nu::Size(256, 256), src.data(), 256 * 4,
+                    nu::PixelFormat::ARGB32, dst.data(), 256 * 4,
+                    nu::PixelFormat::ARGB32Premultiplied);
+  for (size_t i = 0; i < src.size(); ++i)
+    ASSERT_EQ(dst[i], Premultiply(src[i])) << "at " << i;
+}
+
+TEST(PixelFormatTest, RoundTrip) {
+  int stride = kWidth * 4;
+  std::vector<uint8_t> src = CreateRGBA(kWidth, 2, stride);
+  // Opaque pixels survive premultiplication without loss.
+  for (int i = 3; i < stride * 2; i += 4)
+    src[i] = 0xFF;
+  std::vector<uint32_t> premultiplied(kWidth * 2);
+  nu::ConvertPixels(nu::Size(kWidth, 2), src.data(), stride,
+                    nu::PixelFormat::RGBA, premultiplied.data(), stride,
+                    nu::PixelFormat::ARGB32Premultiplied);
+  std::vector<uint8_t> dst(src.size());
+  nu::ConvertPixels(nu::Size(kWidth, 2), premultiplied.data(), stride,
+                    nu::PixelFormat::ARGB32Premultiplied, dst.data(), stride,
+                    nu::PixelFormat::RGBA);
+  EXPECT_EQ(src, dst);
+}
+
+TEST(PixelFormatTest, UnpremultiplyTransparent) {
+  uint32_t src[2] = {0x00000000, 0x80400000};
+  uint32_t dst[2];
+  nu::ConvertPixels(nu::Size(2, 1), src, 8,
+                    nu::PixelFormat::ARGB32Premultiplied, dst, 8,
+                    nu::PixelFormat::ARGB32);
+  EXPECT_EQ(dst[0], 0u);
+  EXPECT_EQ(dst[1], 0x80800000u);
+}
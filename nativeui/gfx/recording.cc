@@ -0,0 +1,220 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/recording.h"
+
+#include <vector>
+
+#include "nativeui/gfx/attributed_text.h"
+#include "nativeui/gfx/canvas.h"
+#include "nativeui/gfx/image.h"
+#include "nativeui/gfx/painter_recorder.h"
+#include "nativeui/gfx/path.h"
+
+namespace nu {
+
+namespace {
+
+// Read arguments from the buffer and advance.
+inline float ReadFloat(const float** args) {
+  return *(*args)++;
+}
+
+inline PointF ReadPoint(const float** args) {
+  const float* a = *args;
+  *args += 2;
+  return PointF(a[0], a[1]);
+}
+
+inline RectF ReadRect(const float** args) {
+  const float* a = *args;
+  *args += 4;
+  return RectF(a[0], a[1], a[2], a[3]);
+}
+
+template<typename T>
+void AppendVector(std::vector<T>* to, const std::vector<T>& from) {
+  if (to == &from) {
+    std::vector<T> items(from);
+    to->insert(to->end(), items.begin(), items.end());
+  } else {
+    to->insert(to->end(), from.begin(), from.end());
+  }
+}
+
+}  // namespace
+
+Recording::Recording() {}
+
+Recording::~Recording() {}
+
+Painter* Recording::GetPainter() {
+  if (!painter_)
+    painter_.reset(new PainterRecorder(this));
+  return painter_.get();
+}
+
+void Recording::Clear() {
+  ops_.clear();
+  args_.clear();
+  colors_.clear();
+  images_.clear();
+  canvases_.clear();
+  paths_.clear();
+  texts_.clear();
+}
+
+void Recording::Replay(Painter* painter) const {
+  const float* args = args_.data();
+  auto color = colors_.begin();
+  auto image = images_.begin();
+  auto canvas = canvases_.begin();
+  auto path = paths_.begin();
+  auto text = texts_.begin();
+  // Unbalanced Save/Restore calls must not affect the caller's state.
+  int depth = 0;
+  for (Op op : ops_) {
+    switch (op) {
+      case Op::Save:
+        ++depth;
+        painter->Save();
+        break;
+      case Op::Restore:
+        if (depth > 0) {
+          --depth;
+          painter->Restore();
+        }
+        break;
+      case Op::BeginPath:
+        painter->BeginPath();
+        break;
+      case Op::ClosePath:
+        painter->ClosePath();
+        break;
+      case Op::MoveTo:
+        painter->MoveTo(ReadPoint(&args));
+        break;
+      case Op::LineTo:
+        painter->LineTo(ReadPoint(&args));
+        break;
+      case Op::BezierCurveTo: {
+        PointF cp1 = ReadPoint(&args);
+        PointF cp2 = ReadPoint(&args);
+        painter->BezierCurveTo(cp1, cp2, ReadPoint(&args));
+        break;
+      }
+      case Op::Arc: {
+        PointF point = ReadPoint(&args);
+        float radius = ReadFloat(&args);
+        float sa = ReadFloat(&args);
+        painter->Arc(point, radius, sa, ReadFloat(&args));
+        break;
+      }
+      case Op::Rect:
+        painter->Rect(ReadRect(&args));
+        break;
+      case Op::Clip:
+        painter->Clip();
+        break;
+      case Op::ClipRect:
+        painter->ClipRect(ReadRect(&args));
+        break;
+      case Op::Translate: {
+        PointF offset = ReadPoint(&args);
+        painter->Translate(Vector2dF(offset.x(), offset.y()));
+        break;
+      }
+      case Op::Rotate:
+        painter->Rotate(ReadFloat(&args));
+        break;
+      case Op::Scale: {
+        PointF scale = ReadPoint(&args);
+        painter->Scale(Vector2dF(scale.x(), scale.y()));
+        break;
+      }
+      case Op::SetColor:
+        painter->SetColor(*color++);
+        break;
+      case Op::SetStrokeColor:
+        painter->SetStrokeColor(*color++);
+        break;
+      case Op::SetFillColor:
+        painter->SetFillColor(*color++);
+        break;
+      case Op::SetLineWidth:
+        painter->SetLineWidth(ReadFloat(&args));
+        break;
+      case Op::Stroke:
+        painter->Stroke();
+        break;
+      case Op::Fill:
+        painter->Fill();
+        break;
+      case Op::StrokePath:
+        painter->StrokePath((path++)->get());
+        break;
+      case Op::FillPath:
+        painter->FillPath((path++)->get());
+        break;
+      case Op::Clear:
+        painter->Clear();
+        break;
+      case Op::StrokeRect:
+        painter->StrokeRect(ReadRect(&args));
+        break;
+      case Op::FillRect:
+        painter->FillRect(ReadRect(&args));
+        break;
+      case Op::DrawImage:
+        painter->DrawImage((image++)->get(), ReadRect(&args));
+        break;
+      case Op::DrawImageFromRect: {
+        RectF src = ReadRect(&args);
+        painter->DrawImageFromRect((image++)->get(), src, ReadRect(&args));
+        break;
+      }
+      case Op::DrawCanvas:
+        painter->DrawCanvas((canvas++)->get(), ReadRect(&args));
+        break;
+      case Op::DrawCanvasFromRect: {
+        RectF src = ReadRect(&args);
+        painter->DrawCanvasFromRect((canvas++)->get(), src, ReadRect(&args));
+        break;
+      }
+      case Op::DrawAttributedText:
+        painter->DrawAttributedText(*text++, ReadRect(&args));
+        break;
+    }
+  }
+  while (depth-- > 0)
+    painter->Restore();
+}
+
+void Recording::Append(const Recording* other) {
+  // Balance Save/Restore calls of |other|, so it can not pop the states saved
+  // before it or leak its states to the operations after it.
+  std::vector<Op> ops;
+  ops.reserve(other->ops_.size());
+  int depth = 0;
+  for (Op op : other->ops_) {
+    if (op == Op::Save) {
+      ++depth;
+    } else if (op == Op::Restore) {
+      if (depth == 0)
+        continue;
+      --depth;
+    }
+    ops.push_back(op);
+  }
+  ops.insert(ops.end(), depth, Op::Restore);
+  ops_.insert(ops_.end(), ops.begin(), ops.end());
+  AppendVector(&args_, other->args_);
+  AppendVector(&colors_, other->colors_);
+  AppendVector(&images_, other->images_);
+  AppendVector(&canvases_, other->canvases_);
+  AppendVector(&paths_, other->paths_);
+  AppendVector(&texts_, other->texts_);
+}
+
+}  // namespace nu
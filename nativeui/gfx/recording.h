@@ -0,0 +1,100 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_RECORDING_H_
+#define NATIVEUI_GFX_RECORDING_H_
+
+#include <memory>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "nativeui/gfx/color.h"
+#include "nativeui/nativeui_export.h"
+
+namespace nu {
+
+class AttributedText;
+class Canvas;
+class Image;
+class Painter;
+class PainterRecorder;
+class Path;
+
+// A list of painting operations that can be replayed without running the
+// code that draws them.
+class NATIVEUI_EXPORT Recording : public base::RefCounted<Recording> {
+ public:
+  Recording();
+
+  // Return the Painter that records operations into this recording.
+  Painter* GetPainter();
+
+  // Remove all recorded operations.
+  void Clear();
+
+  // Return whether there is no recorded operation.
+  bool IsEmpty() const { return ops_.empty(); }
+
+  // Internal: Run the operations on |painter|.
+  void Replay(Painter* painter) const;
+
+ protected:
+  virtual ~Recording();
+
+ private:
+  friend class base::RefCounted<Recording>;
+  friend class PainterRecorder;
+
+  enum class Op : uint8_t {
+    Save,
+    Restore,
+    BeginPath,
+    ClosePath,
+    MoveTo,
+    LineTo,
+    BezierCurveTo,
+    Arc,
+    Rect,
+    Clip,
+    ClipRect,
+    Translate,
+    Rotate,
+    Scale,
+    SetColor,
+    SetStrokeColor,
+    SetFillColor,
+    SetLineWidth,
+    Stroke,
+    Fill,
+    StrokePath,
+    FillPath,
+    Clear,
+    StrokeRect,
+    FillRect,
+    DrawImage,
+    DrawImageFromRect,
+    DrawCanvas,
+    DrawCanvasFromRect,
+    DrawAttributedText,
+  };
+
+  // Append operations of |other|, with its Save/Restore calls balanced.
+  void Append(const Recording* other);
+
+  // The operations, their numeric arguments and the objects they reference,
+  // in the order they are used.
+  std::vector<Op> ops_;
+  std::vector<float> args_;
+  std::vector<Color> colors_;
+  std::vector<scoped_refptr<const Image>> images_;
+  std::vector<scoped_refptr<Canvas>> canvases_;
+  std::vector<scoped_refptr<const Path>> paths_;
+  std::vector<scoped_refptr<AttributedText>> texts_;
+
+  std::unique_ptr<PainterRecorder> painter_;
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_RECORDING_H_
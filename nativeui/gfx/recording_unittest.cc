@@ -0,0 +1,213 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <string.h>
+
+#include <string>
+
+#include "base/strings/stringprintf.h"
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+// Painter that writes the operations into a string.
+class TestPainter : public nu::Painter {
+ public:
+  TestPainter() {}
+
+  void Save() override { log_ += "Save;"; }
+  void Restore() override { log_ += "Restore;"; }
+  void BeginPath() override { log_ += "BeginPath;"; }
+  void ClosePath() override { log_ += "ClosePath;"; }
+  void MoveTo(const nu::PointF& p) override {
+    log_ += base::StringPrintf("MoveTo(%g,%g);", p.x(), p.y());
+  }
+  void LineTo(const nu::PointF& p) override {
+    log_ += base::StringPrintf("LineTo(%g,%g);", p.x(), p.y());
+  }
+  void BezierCurveTo(const nu::PointF& cp1,
+                     const nu::PointF& cp2,
+                     const nu::PointF& ep) override {
+    log_ += base::StringPrintf("BezierCurveTo(%g,%g,%g);",
+                               cp1.x(), cp2.x(), ep.x());
+  }
+  void Arc(const nu::PointF& p, float radius, float sa, float ea) override {
+    log_ += base::StringPrintf("Arc(%g,%g,%g,%g,%g);",
+                               p.x(), p.y(), radius, sa, ea);
+  }
+  void Rect(const nu::RectF& rect) override { LogRect("Rect", rect); }
+  void Clip() override { log_ += "Clip;"; }
+  void ClipRect(const nu::RectF& rect) override { LogRect("ClipRect", rect); }
+  void Translate(const nu::Vector2dF& offset) override {
+    log_ += base::StringPrintf("Translate(%g,%g);", offset.x(), offset.y());
+  }
+  void Rotate(float angle) override {
+    log_ += base::StringPrintf("Rotate(%g);", angle);
+  }
+  void Scale(const nu::Vector2dF& scale) override {
+    log_ += base::StringPrintf("Scale(%g,%g);", scale.x(), scale.y());
+  }
+  void SetColor(nu::Color color) override { LogColor("SetColor", color); }
+  void SetStrokeColor(nu::Color color) override {
+    LogColor("SetStrokeColor", color);
+  }
+  void SetFillColor(nu::Color color) override {
+    LogColor("SetFillColor", color);
+  }
+  void SetLineWidth(float width) override {
+    log_ += base::StringPrintf("SetLineWidth(%g);", width);
+  }
+  void Stroke() override { log_ += "Stroke;"; }
+  void Fill() override { log_ += "Fill;"; }
+  void StrokePath(const nu::Path* path) override { log_ += "StrokePath;"; }
+  void FillPath(const nu::Path* path) override { log_ += "FillPath;"; }
+  void Clear() override { log_ += "Clear;"; }
+  void StrokeRect(const nu::RectF& rect) override {
+    LogRect("StrokeRect", rect);
+  }
+  void FillRect(const nu::RectF& rect) override { LogRect("FillRect", rect); }
+  void DrawImage(const nu::Image* image, const nu::RectF& rect) override {
+    LogRect("DrawImage", rect);
+  }
+  void DrawImageFromRect(const nu::Image* image, const nu::RectF& src,
+                         const nu::RectF& dest) override {
+    LogRect("DrawImageFromRect", dest);
+  }
+  void DrawCanvas(nu::Canvas* canvas, const nu::RectF& rect) override {
+    LogRect("DrawCanvas", rect);
+  }
+  void DrawCanvasFromRect(nu::Canvas* canvas, const nu::RectF& src,
+                          const nu::RectF& dest) override {
+    LogRect("DrawCanvasFromRect", dest);
+  }
+  void DrawAttributedText(scoped_refptr<nu::AttributedText> text,
+                          const nu::RectF& rect) override {
+    LogRect("DrawAttributedText", rect);
+  }
+
+  const std::string& log() const { return log_; }
+
+ private:
+  void LogRect(const char* name, const nu::RectF& r) {
+    log_ += base::StringPrintf("%s(%g,%g,%g,%g);",
+                               name, r.x(), r.y(), r.width(), r.height());
+  }
+
+  void LogColor(const char* name, nu::Color color) {
+    log_ += base::StringPrintf("%s(%08X);", name, color.value());
+  }
+
+  std::string log_;
+};
+
+}  // namespace
+
+TEST(RecordingTest, Replay) {
+  scoped_refptr<nu::Recording> recording = new nu::Recording;
+  EXPECT_TRUE(recording->IsEmpty());
+  nu::Painter* painter = recording->GetPainter();
+  painter->SetFillColor(nu::Color(0x11, 0x22, 0x33));
+  painter->BeginPath();
+  painter->MoveTo(nu::PointF(1, 2));
+  painter->LineTo(nu::PointF(3, 4));
+  painter->Arc(nu::PointF(5, 6), 7, 0, 1);
+  painter->Fill();
+  painter->FillRect(nu::RectF(1, 2, 3, 4));
+  EXPECT_FALSE(recording->IsEmpty());
+
+  TestPainter test;
+  test.DrawRecording(recording.get());
+  EXPECT_EQ(test.log(),
+            "Save;SetFillColor(FF112233);BeginPath;MoveTo(1,2);LineTo(3,4);"
+            "Arc(5,6,7,0,1);Fill;FillRect(1,2,3,4);Restore;");
+}
+
+TEST(RecordingTest, UnbalancedSave) {
+  scoped_refptr<nu::Recording> recording = new nu::Recording;
+  nu::Painter* painter = recording->GetPainter();
+  painter->Restore();
+  painter->Save();
+  painter->Translate(nu::Vector2dF(1, 2));
+
+  TestPainter test;
+  test.DrawRecording(recording.get());
+  EXPECT_EQ(test.log(), "Save;Save;Translate(1,2);Restore;Restore;");
+}
+
+TEST(RecordingTest, DrawRecording) {
+  scoped_refptr<nu::Recording> child = new nu::Recording;
+  child->GetPainter()->Rotate(1);
+  scoped_refptr<nu::Recording> recording = new nu::Recording;
+  recording->GetPainter()->DrawRecording(child.get());
+  recording->GetPainter()->DrawRecording(recording.get());
+  child->Clear();
+
+  TestPainter test;
+  recording->Replay(&test);
+  EXPECT_EQ(test.log(),
+            "Save;Rotate(1);Restore;"
+            "Save;Save;Rotate(1);Restore;Save;Restore;Restore;");
+}
+
+TEST(RecordingTest, DrawUnbalancedRecording) {
+  scoped_refptr<nu::Recording> child = new nu::Recording;
+  nu::Painter* painter = child->GetPainter();
+  painter->Restore();
+  painter->Save();
+  painter->Translate(nu::Vector2dF(1, 2));
+  scoped_refptr<nu::Recording> recording = new nu::Recording;
+  painter = recording->GetPainter();
+  painter->Save();
+  painter->SetLineWidth(3);
+  painter->DrawRecording(child.get());
+  painter->Rotate(1);
+  painter->Restore();
+
+  TestPainter test;
+  recording->Replay(&test);
+  EXPECT_EQ(test.log(),
+            "Save;SetLineWidth(3);Save;Save;Translate(1,2);Restore;Restore;"
+            "Rotate(1);Restore;");
+}
+
+TEST(RecordingTest, Path) {
+  scoped_refptr<nu::Path> path = new nu::Path;
+  path->Rect(nu::RectF(1, 2, 3, 4));
+  scoped_refptr<nu::Recording> recording = new nu::Recording;
+  recording->GetPainter()->FillPath(path.get());
+  recording->GetPainter()->StrokePath(path.get());
+  path = nullptr;
+
+  TestPainter test;
+  recording->Replay(&test);
+  EXPECT_EQ(test.log(), "FillPath;StrokePath;");
+}
+
+TEST(RecordingTest, BulkDrawing) {
+  scoped_refptr<nu::Recording> recording = new nu::Recording;
+  nu::Painter* painter = recording->GetPainter();
+  const float rects[] = {1, 2, 3, 4, 5, 6, 7, 8};
+  painter->FillRects(rects, 2);
+  const float points[] = {1, 2, 3, 4};
+  painter->DrawPolyline(points, 2);
+
+  TestPainter test;
+  recording->Replay(&test);
+  EXPECT_EQ(test.log(),
+            "BeginPath;Rect(1,2,3,4);Rect(5,6,7,8);Fill;"
+            "BeginPath;MoveTo(1,2);LineTo(3,4);Stroke;");
+}
+
+TEST(RecordingTest, BulkDrawingUnalignedBytes) {
+  scoped_refptr<nu::Recording> recording = new nu::Recording;
+  const float rect[] = {1, 2, 3, 4};
+  char bytes[sizeof(rect) + 1];
+  memcpy(bytes + 1, rect, sizeof(rect));
+  recording->GetPainter()->FillRects(bytes + 1, sizeof(rect));
+
+  TestPainter test;
+  recording->Replay(&test);
+  EXPECT_EQ(test.log(), "BeginPath;Rect(1,2,3,4);Fill;");
+}
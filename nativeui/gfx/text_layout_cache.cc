@@ -0,0 +1,75 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/text_layout_cache.h"
+
+#include <tuple>
+
+#include "nativeui/state.h"
+
+namespace nu {
+
+namespace {
+
+// Default capacity, enough for the visible cells of a large table.
+const uint32_t kDefaultCapacity = 1024;
+
+}  // namespace
+
+bool TextLayoutCache::Key::operator<(const Key& other) const {
+  return std::tie(text, font, color, format.align, format.valign,
+                  format.wrap, format.ellipsis) <
+         std::tie(other.text, other.font, other.color, other.format.align,
+                  other.format.valign, other.format.wrap,
+                  other.format.ellipsis);
+}
+
+// static
+TextLayoutCache* TextLayoutCache::GetCurrent() {
+  return State::GetCurrent()->GetTextLayoutCache();
+}
+
+TextLayoutCache::TextLayoutCache() : capacity_(kDefaultCapacity) {}
+
+TextLayoutCache::~TextLayoutCache() {}
+
+scoped_refptr<AttributedText> TextLayoutCache::Get(
+    const std::string& text,
+    const TextAttributes& attributes) {
+  Key key = {text, attributes.font.get(), attributes.color.value(),
+             attributes.ToTextFormat()};
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    ++hit_count_;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->text;
+  }
+  ++miss_count_;
+  scoped_refptr<AttributedText> layout = new AttributedText(text, attributes);
+  if (capacity_ == 0)
+    return layout;
+  EvictUntil(capacity_ - 1);
+  entries_.push_front({key, attributes.font, layout});
+  index_[key] = entries_.begin();
+  return layout;
+}
+
+void TextLayoutCache::SetCapacity(uint32_t capacity) {
+  capacity_ = capacity;
+  EvictUntil(capacity_);
+}
+
+void TextLayoutCache::Clear() {
+  entries_.clear();
+  index_.clear();
+}
+
+void TextLayoutCache::EvictUntil(size_t count) {
+  while (entries_.size() > count) {
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace nu
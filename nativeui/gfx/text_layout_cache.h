@@ -0,0 +1,85 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_TEXT_LAYOUT_CACHE_H_
+#define NATIVEUI_GFX_TEXT_LAYOUT_CACHE_H_
+
+#include <list>
+#include <map>
+#include <string>
+
+#include "nativeui/gfx/attributed_text.h"
+
+namespace nu {
+
+// Cache of laid out texts, so the same text drawn with the same attributes is
+// only shaped once. This class is managed by State.
+class NATIVEUI_EXPORT TextLayoutCache {
+ public:
+  ~TextLayoutCache();
+
+  static TextLayoutCache* GetCurrent();
+
+  // Return the layout of |text| with |attributes|, the returned text is shared
+  // and must not be modified. The layout is not bound to a size, painters set
+  // the size of drawing area on it before each use.
+  scoped_refptr<AttributedText> Get(const std::string& text,
+                                    const TextAttributes& attributes);
+
+  // Set the maximum number of layouts kept by the cache, least recently used
+  // layouts are evicted first when exceeded.
+  void SetCapacity(uint32_t capacity);
+  uint32_t GetCapacity() const { return capacity_; }
+
+  // Return the number of layouts kept by the cache.
+  uint32_t GetCount() const { return static_cast<uint32_t>(entries_.size()); }
+
+  // Statistics of cache lookups.
+  uint32_t GetHitCount() const { return hit_count_; }
+  uint32_t GetMissCount() const { return miss_count_; }
+
+  // Remove all layouts from cache.
+  void Clear();
+
+ private:
+  friend class State;
+
+  // Fonts are identified by address, the entry keeps a reference to the font
+  // so the address is not reused while cached.
+  struct Key {
+    std::string text;
+    Font* font;
+    uint32_t color;
+    TextFormat format;
+
+    bool operator<(const Key& other) const;
+  };
+
+  struct Entry {
+    Key key;
+    scoped_refptr<Font> font;
+    scoped_refptr<AttributedText> text;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  TextLayoutCache();
+
+  // Remove least recently used layouts until there are no more than |count|.
+  void EvictUntil(size_t count);
+
+  // Most recently used layouts at the front.
+  EntryList entries_;
+  std::map<Key, EntryList::iterator> index_;
+
+  uint32_t capacity_;
+  uint32_t hit_count_ = 0;
+  uint32_t miss_count_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(TextLayoutCache);
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_TEXT_LAYOUT_CACHE_H_
@@ -0,0 +1,68 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class TextLayoutCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    cache_ = nu::TextLayoutCache::GetCurrent();
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  nu::TextLayoutCache* cache_;
+};
+
+TEST_F(TextLayoutCacheTest, Get) {
+  nu::TextAttributes attributes;
+  scoped_refptr<nu::AttributedText> text = cache_->Get("text", attributes);
+  EXPECT_EQ(text->GetText(), "text");
+  EXPECT_EQ(cache_->GetMissCount(), 1u);
+  EXPECT_EQ(cache_->Get("text", attributes), text);
+  EXPECT_EQ(cache_->GetHitCount(), 1u);
+  EXPECT_EQ(cache_->GetCount(), 1u);
+}
+
+TEST_F(TextLayoutCacheTest, KeyedByAttributes) {
+  nu::TextAttributes attributes;
+  scoped_refptr<nu::AttributedText> text = cache_->Get("text", attributes);
+  attributes.color = nu::Color(0xFF, 0, 0);
+  EXPECT_NE(cache_->Get("text", attributes), text);
+  attributes.wrap = false;
+  EXPECT_NE(cache_->Get("text", attributes), text);
+  EXPECT_EQ(cache_->GetHitCount(), 0u);
+  EXPECT_EQ(cache_->GetCount(), 3u);
+}
+
+TEST_F(TextLayoutCacheTest, ShareLayoutForDifferentSizes) {
+  nu::TextAttributes attributes;
+  scoped_refptr<nu::AttributedText> text = cache_->Get("text text", attributes);
+  scoped_refptr<nu::Canvas> canvas = new nu::Canvas(nu::SizeF(100, 100), 1);
+  nu::Painter* painter = canvas->GetPainter();
+  painter->DrawText("text text", nu::RectF(0, 0, 100, 20), attributes);
+  painter->DrawText("text text", nu::RectF(0, 0, 10, 100), attributes);
+  EXPECT_EQ(cache_->GetHitCount(), 2u);
+  EXPECT_EQ(cache_->GetCount(), 1u);
+  // The size of each drawing does not stick to the shared layout.
+  scoped_refptr<nu::AttributedText> fresh =
+      new nu::AttributedText("text text", attributes);
+  EXPECT_EQ(text->GetBoundsFor(nu::SizeF(100, 20)),
+            fresh->GetBoundsFor(nu::SizeF(100, 20)));
+}
+
+TEST_F(TextLayoutCacheTest, EvictLeastRecentlyUsed) {
+  nu::TextAttributes attributes;
+  cache_->SetCapacity(2);
+  scoped_refptr<nu::AttributedText> a = cache_->Get("a", attributes);
+  scoped_refptr<nu::AttributedText> b = cache_->Get("b", attributes);
+  cache_->Get("a", attributes);
+  cache_->Get("c", attributes);
+  EXPECT_EQ(cache_->GetCount(), 2u);
+  EXPECT_EQ(cache_->Get("a", attributes), a);
+  EXPECT_NE(cache_->Get("b", attributes), b);
+  cache_->Clear();
+  EXPECT_EQ(cache_->GetCount(), 0u);
+}
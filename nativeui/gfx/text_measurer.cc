@@ -0,0 +1,40 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/text_measurer.h"
+
+#include <float.h>
+
+#include <utility>
+
+#include "nativeui/gfx/font.h"
+
+namespace nu {
+
+TextMeasurer::TextMeasurer(TextAttributes attributes)
+    : attributes_(std::move(attributes)),
+      text_(new AttributedText("", attributes_)) {}
+
+TextMeasurer::~TextMeasurer() {}
+
+std::vector<SizeF> TextMeasurer::Measure(const std::vector<std::string>& texts,
+                                         const SizeF& size) const {
+  std::vector<SizeF> sizes;
+  sizes.reserve(texts.size());
+  for (const std::string& text : texts) {
+    text_->SetText(text);
+    // Replacing an empty text loses the attributes on macOS, and setting the
+    // font of whole text is cheap on all platforms.
+    text_->SetFont(attributes_.font);
+    sizes.push_back(text_->GetBoundsFor(size).size());
+  }
+  return sizes;
+}
+
+std::vector<SizeF> TextMeasurer::MeasureOneLine(
+    const std::vector<std::string>& texts) const {
+  return Measure(texts, SizeF(FLT_MAX, FLT_MAX));
+}
+
+}  // namespace nu
@@ -0,0 +1,47 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GFX_TEXT_MEASURER_H_
+#define NATIVEUI_GFX_TEXT_MEASURER_H_
+
+#include <string>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "nativeui/gfx/attributed_text.h"
+#include "nativeui/gfx/text.h"
+
+namespace nu {
+
+// Measure many strings drawn with the same attributes, by reusing one native
+// text layout instead of creating an AttributedText for each string.
+class NATIVEUI_EXPORT TextMeasurer : public base::RefCounted<TextMeasurer> {
+ public:
+  explicit TextMeasurer(TextAttributes attributes);
+
+  // Return the size of each text when drawn within |size|.
+  std::vector<SizeF> Measure(const std::vector<std::string>& texts,
+                             const SizeF& size) const;
+
+  // Return the size of each text when drawn in one line.
+  std::vector<SizeF> MeasureOneLine(
+      const std::vector<std::string>& texts) const;
+
+  const TextAttributes& GetAttributes() const { return attributes_; }
+
+ protected:
+  virtual ~TextMeasurer();
+
+ private:
+  friend class base::RefCounted<TextMeasurer>;
+
+  TextAttributes attributes_;
+  scoped_refptr<AttributedText> text_;
+
+  DISALLOW_COPY_AND_ASSIGN(TextMeasurer);
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GFX_TEXT_MEASURER_H_
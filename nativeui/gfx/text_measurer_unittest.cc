@@ -0,0 +1,39 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class TextMeasurerTest : public testing::Test {
+ protected:
+  nu::Lifetime lifetime_;
+  nu::State state_;
+};
+
+TEST_F(TextMeasurerTest, MeasureOneLine) {
+  nu::TextAttributes attributes;
+  scoped_refptr<nu::TextMeasurer> measurer = new nu::TextMeasurer(attributes);
+  std::vector<std::string> texts = {"text", "", "some longer text", "text"};
+  std::vector<nu::SizeF> sizes = measurer->MeasureOneLine(texts);
+  ASSERT_EQ(sizes.size(), texts.size());
+  EXPECT_GT(sizes[2].width(), sizes[0].width());
+  EXPECT_EQ(sizes[3], sizes[0]);
+  for (size_t i = 0; i < texts.size(); ++i) {
+    if (texts[i].empty())
+      continue;
+    scoped_refptr<nu::AttributedText> text =
+        new nu::AttributedText(texts[i], attributes);
+    EXPECT_EQ(sizes[i], text->GetOneLineSize());
+  }
+}
+
+TEST_F(TextMeasurerTest, Measure) {
+  scoped_refptr<nu::TextMeasurer> measurer =
+      new nu::TextMeasurer(nu::TextAttributes());
+  std::vector<nu::SizeF> sizes = measurer->Measure(
+      {"some long text that should be wrapped"}, nu::SizeF(40, 1000));
+  ASSERT_EQ(sizes.size(), 1u);
+  EXPECT_GT(sizes[0].height(),
+            measurer->MeasureOneLine({"some"})[0].height());
+}
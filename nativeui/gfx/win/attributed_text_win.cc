@@ -60,7 +60,7 @@ void AttributedText::PlatformSetColorFor(Color color, int start, int end) {
   text_->brush.reset(new Gdiplus::SolidBrush(ToGdi(color)));
 }
 
-RectF AttributedText::GetBoundsFor(const SizeF& size) const {
+RectF AttributedText::PlatformGetBoundsFor(const SizeF& size) const {
   // MeasureString does not take account of the last new line, add a character
   // to make it behave the same with other platforms.
   bool ends_with_newline = text_->text.size() > 0 &&
@@ -83,7 +83,7 @@ RectF AttributedText::GetBoundsFor(const SizeF& size) const {
                rect.Width / scale_factor, rect.Height / scale_factor);
 }
 
-void AttributedText::SetText(const std::string& text) {
+void AttributedText::PlatformSetText(const std::string& text) {
   text_->text = base::UTF8ToUTF16(text);
 }
 
@@ -31,4 +31,18 @@ Painter* Canvas::PlatformCreatePainter(NativeBitmap bitmap,
   return new PainterWin(bitmap->dc(), bitmap->size(), scale_factor);
 }
 
+// static
+Canvas::Pixels Canvas::PlatformLockPixels(NativeBitmap bitmap) {
+  // GDI batches drawing operations.
+  ::GdiFlush();
+  int stride = bitmap->size().width() * 4;
+  return {Buffer::Wrap(bitmap->bits(), stride * bitmap->size().height()),
+          bitmap->size(), stride, PixelFormat::ARGB32};
+}
+
+// static
+void Canvas::PlatformUnlockPixels(NativeBitmap bitmap) {
+  // The DIB section is read from memory directly.
+}
+
 }  // namespace nu
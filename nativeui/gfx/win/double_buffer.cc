@@ -8,18 +8,18 @@ namespace nu {
 
 namespace {
 
-HBITMAP CreateBitmap(HDC dc, const Size& size) {
+HBITMAP CreateBitmap(HDC dc, const Size& size, void** bits) {
   BITMAPINFOHEADER bih = { 0 };
   bih.biBitCount = 32;
   bih.biSize = sizeof(BITMAPINFOHEADER);
   bih.biWidth = size.width();
-  bih.biHeight = size.height();
+  // Use top-down bitmap so the memory has same layout with other platforms.
+  bih.biHeight = -size.height();
   bih.biPlanes = 1;
   bih.biSizeImage = size.width() * size.height() * 4;
   bih.biCompression = BI_RGB;
-  RGBQUAD* bits = nullptr;
   return ::CreateDIBSection(dc, reinterpret_cast<BITMAPINFO*>(&bih), 0,
-                            reinterpret_cast<void**>(&bits), NULL, 0);
+                            bits, NULL, 0);
 }
 
 }  // namespace
@@ -34,7 +34,7 @@ DoubleBuffer::DoubleBuffer(HDC dc, const Size& size, const Rect& src,
                            const Point& dest)
     : dc_(dc), size_(size), src_(src), dest_(dest),
       mem_dc_(::CreateCompatibleDC(dc)),
-      mem_bitmap_(CreateBitmap(dc, size)),
+      mem_bitmap_(CreateBitmap(dc, size, &bits_)),
       select_bitmap_(mem_dc_.Get(), mem_bitmap_.get()) {}
 
 DoubleBuffer::~DoubleBuffer() {
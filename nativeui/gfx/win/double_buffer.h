@@ -33,12 +33,16 @@ class DoubleBuffer {
   HDC dc() const { return mem_dc_.Get(); }
   Size size() const { return size_; }
 
+  // Return the top-down 32bpp memory of the bitmap.
+  void* bits() const { return bits_; }
+
  private:
   HDC dc_;
   Size size_;
   Rect src_;
   Point dest_;
   base::win::ScopedCreateDC mem_dc_;
+  void* bits_ = nullptr;
   base::win::ScopedBitmap mem_bitmap_;
   base::win::ScopedSelectObject select_bitmap_;
 
@@ -7,6 +7,9 @@
 #include <shlwapi.h>
 #include <wrl.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "base/logging.h"
 #include "base/win/scoped_hglobal.h"
 #include "nativeui/gfx/canvas.h"
@@ -22,6 +25,54 @@ Image::Image(const base::FilePath& path)
     : scale_factor_(GetScaleFactorFromFilePath(path)),
       image_(new Gdiplus::Image(path.value().c_str())) {}
 
+Image::Image(const Buffer& pixels,
+             const Size& size,
+             int stride,
+             PixelFormat format,
+             float scale_factor)
+    : scale_factor_(scale_factor) {
+  if (!IsValidPixelBuffer(size, stride, pixels.size())) {
+    image_ = new Gdiplus::Image(L"");
+    return;
+  }
+  // GDI+ has both premultiplied and straight ARGB formats.
+  bool premultiplied = format == PixelFormat::ARGB32Premultiplied;
+  Gdiplus::Bitmap* bitmap = new Gdiplus::Bitmap(
+      size.width(), size.height(),
+      premultiplied ? PixelFormat32bppPARGB : PixelFormat32bppARGB);
+  Gdiplus::Rect rect(0, 0, size.width(), size.height());
+  Gdiplus::BitmapData data;
+  if (bitmap->LockBits(&rect, Gdiplus::ImageLockModeWrite,
+                       bitmap->GetPixelFormat(), &data) == Gdiplus::Ok) {
+    ConvertPixels(size, pixels.content(), stride, format,
+                  data.Scan0, data.Stride,
+                  premultiplied ? PixelFormat::ARGB32Premultiplied
+                                : PixelFormat::ARGB32);
+    bitmap->UnlockBits(&data);
+  }
+  image_ = bitmap;
+}
+
+Image::Image(const base::FilePath& path, const SizeF& max_size)
+    : scale_factor_(GetScaleFactorFromFilePath(path)) {
+  // GDI+ can not decode at a smaller resolution, but keeping only the scaled
+  // bitmap still saves the memory and the scaling when painting.
+  Gdiplus::Image image(path.value().c_str());
+  Size size(image.GetWidth(), image.GetHeight());
+  Size decode_size = GetDecodeSize(size, max_size, scale_factor_);
+  if (decode_size == size) {
+    image_ = size.IsEmpty() ? new Gdiplus::Image(L"") : image.Clone();
+    return;
+  }
+  Gdiplus::Bitmap* bitmap = new Gdiplus::Bitmap(
+      decode_size.width(), decode_size.height(), PixelFormat32bppPARGB);
+  Gdiplus::Graphics graphics(bitmap);
+  graphics.SetInterpolationMode(Gdiplus::InterpolationModeHighQualityBicubic);
+  graphics.SetPixelOffsetMode(Gdiplus::PixelOffsetModeHalf);
+  graphics.DrawImage(&image, 0, 0, decode_size.width(), decode_size.height());
+  image_ = bitmap;
+}
+
 Image::Image(const Buffer& buffer, float scale_factor)
     : scale_factor_(scale_factor) {
   HGLOBAL glob = ::GlobalAlloc(GPTR, buffer.size());
@@ -49,6 +100,19 @@ SizeF Image::GetSize() const {
                    1.f / scale_factor_);
 }
 
+size_t Image::GetMemorySize() const {
+  Gdiplus::Image* image = const_cast<Gdiplus::Image*>(image_);
+  size_t frames_count = 1;
+  UINT dimensions_count = image->GetFrameDimensionsCount();
+  if (dimensions_count > 0) {
+    std::vector<GUID> ids(dimensions_count);
+    image->GetFrameDimensionsList(ids.data(), dimensions_count);
+    frames_count = std::max<UINT>(image->GetFrameCount(&ids[0]), 1);
+  }
+  return static_cast<size_t>(image->GetWidth()) * image->GetHeight() * 4 *
+         frames_count;
+}
+
 base::win::ScopedHICON Image::GetHICON(const SizeF& size) const {
   scoped_refptr<Canvas> canvas = new Canvas(size);
   canvas->GetPainter()->DrawImage(this, RectF(size));
@@ -20,6 +20,7 @@
 #include "nativeui/gfx/geometry/size_conversions.h"
 #include "nativeui/gfx/geometry/vector2d_conversions.h"
 #include "nativeui/gfx/image.h"
+#include "nativeui/gfx/path.h"
 #include "nativeui/gfx/win/attributed_text_win.h"
 #include "nativeui/gfx/win/double_buffer.h"
 #include "nativeui/state.h"
@@ -148,6 +149,29 @@ void PainterWin::Fill() {
   path_.Reset();
 }
 
+void PainterWin::StrokePath(const Path* path) {
+  // The path is in DIP, scale it instead of the points, and keep line width
+  // in pixels like Stroke.
+  auto state = graphics_.Save();
+  graphics_.ScaleTransform(scale_factor_, scale_factor_);
+  Gdiplus::Pen pen(ToGdi(top().stroke_color),
+                   top().line_width / scale_factor_);
+  graphics_.DrawPath(&pen, path->GetNative());
+  graphics_.Restore(state);
+  use_gdi_current_point_ = true;
+  path_.Reset();
+}
+
+void PainterWin::FillPath(const Path* path) {
+  auto state = graphics_.Save();
+  graphics_.ScaleTransform(scale_factor_, scale_factor_);
+  Gdiplus::SolidBrush brush(ToGdi(top().fill_color));
+  graphics_.FillPath(&brush, path->GetNative());
+  graphics_.Restore(state);
+  use_gdi_current_point_ = true;
+  path_.Reset();
+}
+
 void PainterWin::Clear() {
   auto state = graphics_.Save();
   Gdiplus::SolidBrush brush(Gdiplus::Color(0, 0, 0, 0));
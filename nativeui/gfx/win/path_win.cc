@@ -0,0 +1,91 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gfx/path.h"
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include "nativeui/gfx/win/gdiplus.h"
+
+namespace nu {
+
+NativePath Path::PlatformCreate() const {
+  Gdiplus::GraphicsPath* path = new Gdiplus::GraphicsPath;
+  // GDI+ does not have current point, track it like PainterWin.
+  Gdiplus::PointF current;
+  Gdiplus::PointF figure_start;
+  bool has_current = false;
+  const float* a = args_.data();
+  for (Op op : ops_) {
+    switch (op) {
+      case Op::MoveTo:
+        path->StartFigure();
+        current = figure_start = Gdiplus::PointF(a[0], a[1]);
+        has_current = true;
+        a += 2;
+        break;
+      case Op::LineTo:
+        if (has_current)
+          path->AddLine(current, Gdiplus::PointF(a[0], a[1]));
+        else
+          figure_start = Gdiplus::PointF(a[0], a[1]);
+        current = Gdiplus::PointF(a[0], a[1]);
+        has_current = true;
+        a += 2;
+        break;
+      case Op::BezierCurveTo:
+        if (has_current)
+          path->AddBezier(current,
+                          Gdiplus::PointF(a[0], a[1]),
+                          Gdiplus::PointF(a[2], a[3]),
+                          Gdiplus::PointF(a[4], a[5]));
+        else
+          figure_start = Gdiplus::PointF(a[4], a[5]);
+        current = Gdiplus::PointF(a[4], a[5]);
+        has_current = true;
+        a += 6;
+        break;
+      case Op::Arc: {
+        float radius = a[2];
+        float sa = a[3];
+        float ea = a[4];
+        // Normalize the angle to clockwise.
+        if (ea < sa) {
+          while (ea <= sa)
+            ea += 2.0f * static_cast<float>(M_PI);
+        }
+        path->AddArc(a[0] - radius, a[1] - radius, 2.0f * radius,
+                     2.0f * radius, sa / M_PI * 180.0f,
+                     (ea - sa) / M_PI * 180.0f);
+        if (path->GetLastPoint(&current) == Gdiplus::Ok)
+          has_current = true;
+        a += 5;
+        break;
+      }
+      case Op::Rect:
+        path->AddRectangle(Gdiplus::RectF(a[0], a[1], a[2], a[3]));
+        // Drawing rectangle should update current point.
+        current = figure_start = Gdiplus::PointF(a[0], a[1]);
+        has_current = true;
+        a += 4;
+        break;
+      case Op::ClosePath:
+        path->CloseFigure();
+        current = figure_start;
+        break;
+    }
+  }
+  Gdiplus::Matrix matrix(matrix_[0], matrix_[1], matrix_[2], matrix_[3],
+                         matrix_[4], matrix_[5]);
+  path->Transform(&matrix);
+  return path;
+}
+
+// static
+void Path::PlatformDestroy(NativePath path) {
+  delete path;
+}
+
+}  // namespace nu
@@ -51,6 +51,7 @@ ImageScale GifPlayer::GetScale() const {
   return scale_;
 }
 
+#if !defined(OS_LINUX)
 bool GifPlayer::IsPlaying() const {
   return timer_ != 0;
 }
@@ -61,6 +62,7 @@ void GifPlayer::StopAnimationTimer() {
     timer_ = 0;
   }
 }
+#endif
 
 void GifPlayer::Paint(Painter* painter) {
   // Calulate image position.
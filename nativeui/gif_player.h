@@ -66,7 +66,13 @@ class NATIVEUI_EXPORT GifPlayer : public View {
   std::unique_ptr<BYTE[]> frame_delays_;
 #endif
 
+#if defined(OS_LINUX)
+  // Whether a non-looping animation has played its last frame.
+  bool ended_ = false;
+#else
+  // On Linux frames are scheduled by the shared FrameClock.
   MessageLoop::TimerId timer_ = 0;
+#endif
 
   bool is_animating_ = false;
   ImageScale scale_ = ImageScale::None;
@@ -8,6 +8,7 @@
 
 #include "nativeui/gfx/gtk/painter_gtk.h"
 #include "nativeui/gfx/image.h"
+#include "nativeui/gtk/util/frame_clock.h"
 
 namespace nu {
 
@@ -27,6 +28,10 @@ gboolean OnDraw(GtkWidget* widget, cairo_t* cr, GifPlayer* view) {
 
   PainterGtk painter(cr, SizeF(width, height));
   view->Paint(&painter);
+
+  // The animation is paused when scrolled out of view, resume it now.
+  if (view->IsAnimating() && !view->IsPlaying())
+    view->ScheduleFrame();
   return FALSE;
 }
 
@@ -52,11 +57,19 @@ GifPlayer::GifPlayer() {
 }
 
 GifPlayer::~GifPlayer() {
-  if (timer_ > 0)
-    StopAnimationTimer();
+  StopAnimationTimer();
+}
+
+bool GifPlayer::IsPlaying() const {
+  return FrameClock::GetCurrent()->IsScheduled(GetNative());
+}
+
+void GifPlayer::StopAnimationTimer() {
+  FrameClock::GetCurrent()->Cancel(GetNative());
 }
 
 void GifPlayer::PlatformSetImage(Image* image) {
+  ended_ = false;
   SchedulePaint();
   // Start animation by default.
   SetAnimating(!!image);
@@ -67,15 +80,20 @@ bool GifPlayer::CanAnimate() const {
 }
 
 void GifPlayer::ScheduleFrame() {
+  // The ended animation stays on its last frame, do not resume it on draw.
+  if (ended_)
+    return;
   // Advance frame.
   image_->AdvanceFrame();
   // Emit draw event.
   SchedulePaint();
-  // Schedule next call.
-  if (is_animating_) {
-    timer_ = MessageLoop::SetTimeout(
-        gdk_pixbuf_animation_iter_get_delay_time(image_->iter()),
-        std::bind(&GifPlayer::ScheduleFrame, this));
+  // Schedule next call, a negative delay means the animation has ended.
+  int delay = image_->GetFrameDelay();
+  if (delay < 0) {
+    ended_ = true;
+  } else if (is_animating_) {
+    FrameClock::GetCurrent()->Schedule(
+        GetNative(), delay, std::bind(&GifPlayer::ScheduleFrame, this));
   }
 }
 
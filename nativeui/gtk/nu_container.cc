@@ -137,13 +137,26 @@ static void nu_container_get_preferred_height(GtkWidget* widget,
 
 static void nu_container_size_allocate(GtkWidget* widget,
                                        GtkAllocation* allocation) {
+  GtkAllocation old_allocation;
+  gtk_widget_get_allocation(widget, &old_allocation);
   gtk_widget_set_allocation(widget, allocation);
 
-  // Though nu::Container::OnSizeChanged is responsible for setting the
-  // sizes of children, we have to allocate size here otherwise children
-  // may have problems rendering.
+  // Children are allocated in window coordinates, so they must be moved with
+  // the container.
   NUContainerPrivate* priv = NU_CONTAINER(widget)->priv;
-  priv->delegate->SetChildBoundsFromCSS();
+  if (old_allocation.x != allocation->x || old_allocation.y != allocation->y) {
+    priv->delegate->SetChildBoundsFromCSS();
+  } else {
+    // Though nu::Container::OnSizeChanged is responsible for setting the
+    // sizes of children, children waiting for allocation must be allocated
+    // here otherwise they may have problems rendering. Clean children are
+    // left alone so a resize does not re-allocate the whole tree.
+    for (int i = 0; i < priv->delegate->ChildCount(); ++i) {
+      View* child = priv->delegate->ChildAt(i);
+      if (gtk_widget_get_alloc_needed(child->GetNative()))
+        child->SetPixelBounds(child->GetPixelBounds());
+    }
+  }
 
   if (gtk_widget_get_realized(widget) && priv->event_window) {
     gdk_window_move_resize(priv->event_window,
@@ -162,13 +175,35 @@ static gboolean nu_container_draw(GtkWidget* widget, cairo_t* cr) {
   gtk_render_background(gtk_widget_get_style_context(widget), cr,
                         0, 0, width, height);
 
+  // Only the clip area needs redrawing, which is usually smaller than widget
+  // when the paint is scheduled with SchedulePaintRect.
+  GdkRectangle dirty;
+  if (!gdk_cairo_get_clip_rectangle(cr, &dirty))
+    return FALSE;
+
   Container* delegate = NU_CONTAINER(widget)->priv->delegate;
-  PainterGtk painter(cr, SizeF(width, height));
-  delegate->on_draw.Emit(delegate, &painter, nu::RectF(0, 0, width, height));
+  if (!delegate->on_draw.IsEmpty()) {
+    PainterGtk painter(cr, SizeF(width, height));
+    delegate->on_draw.Emit(delegate, &painter,
+                           nu::RectF(dirty.x, dirty.y,
+                                     dirty.width, dirty.height));
+  }
 
-  for (int i = 0; i < delegate->ChildCount(); ++i)
-    gtk_container_propagate_draw(GTK_CONTAINER(widget),
-                                 delegate->ChildAt(i)->GetNative(), cr);
+  // Allocations of children are relative to the parent window, while the
+  // context is relative to this widget.
+  GtkAllocation allocation;
+  gtk_widget_get_allocation(widget, &allocation);
+  for (int i = 0; i < delegate->ChildCount(); ++i) {
+    GtkWidget* child = delegate->ChildAt(i)->GetNative();
+    // Use clip instead of allocation since widgets can draw outside their
+    // allocations, e.g. shadows.
+    GdkRectangle clip;
+    gtk_widget_get_clip(child, &clip);
+    clip.x -= allocation.x;
+    clip.y -= allocation.y;
+    if (gdk_rectangle_intersect(&clip, &dirty, nullptr))
+      gtk_container_propagate_draw(GTK_CONTAINER(widget), child, cr);
+  }
   return FALSE;
 }
 
@@ -53,7 +53,7 @@ static gboolean nu_label_draw(GtkWidget* widget, cairo_t* cr) {
 
   auto* label = NU_LABEL(widget)->priv->label;
   PainterGtk painter(cr, SizeF(width, height));
-  painter.DrawAttributedText(label->GetAttributedText(),
+  painter.DrawAttributedText(label->GetTextLayout(),
                              RectF(0, 0, width, height));
   return false;
 }
@@ -5,12 +5,19 @@
 #include "nativeui/state.h"
 
 #include "nativeui/gfx/gtk/gtk_theme.h"
+#include "nativeui/gtk/util/frame_clock.h"
 
 namespace nu {
 
 void State::PlatformInit() {
 }
 
+FrameClock* State::GetFrameClock() {
+  if (!frame_clock_)
+    frame_clock_.reset(new FrameClock);
+  return frame_clock_.get();
+}
+
 GtkTheme* State::GetGtkTheme() {
   if (!gtk_theme_)
     gtk_theme_.reset(new GtkTheme);
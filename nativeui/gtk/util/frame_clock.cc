@@ -0,0 +1,148 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gtk/util/frame_clock.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "nativeui/gtk/util/widget_util.h"
+#include "nativeui/state.h"
+
+namespace nu {
+
+FrameClock::FrameClock() {}
+
+FrameClock::~FrameClock() {
+  if (timer_ > 0)
+    g_source_remove(timer_);
+  while (!connections_.empty())
+    Disconnect(connections_.back().clock);
+}
+
+// static
+FrameClock* FrameClock::GetCurrent() {
+  return State::GetCurrent()->GetFrameClock();
+}
+
+void FrameClock::Schedule(GtkWidget* widget, int delay, Callback callback) {
+  Cancel(widget);
+  entries_.push_back({widget, std::move(callback),
+                      g_get_monotonic_time() + delay * 1000, nullptr});
+  UpdateTimer();
+}
+
+void FrameClock::Cancel(GtkWidget* widget) {
+  auto it = Find(widget);
+  if (it == entries_.end())
+    return;
+  GdkFrameClock* clock = it->clock;
+  entries_.erase(it);
+  if (clock)
+    DisconnectIfUnused(clock);
+  UpdateTimer();
+}
+
+bool FrameClock::IsScheduled(GtkWidget* widget) const {
+  return std::any_of(entries_.begin(), entries_.end(),
+                     [widget](const Entry& e) { return e.widget == widget; });
+}
+
+std::vector<FrameClock::Entry>::iterator FrameClock::Find(GtkWidget* widget) {
+  return std::find_if(entries_.begin(), entries_.end(),
+                      [widget](const Entry& e) { return e.widget == widget; });
+}
+
+void FrameClock::Disconnect(GdkFrameClock* clock) {
+  auto it = std::find_if(connections_.begin(), connections_.end(),
+                         [clock](const Connection& c) {
+                           return c.clock == clock;
+                         });
+  if (it == connections_.end())
+    return;
+  g_signal_handler_disconnect(clock, it->signal);
+  // The clock was referenced when connected, in case the window is destroyed
+  // while waiting for update.
+  g_object_unref(clock);
+  connections_.erase(it);
+}
+
+void FrameClock::DisconnectIfUnused(GdkFrameClock* clock) {
+  if (std::none_of(entries_.begin(), entries_.end(),
+                   [clock](const Entry& e) { return e.clock == clock; }))
+    Disconnect(clock);
+}
+
+void FrameClock::UpdateTimer() {
+  // Entries waiting for frame clocks do not need timer.
+  gint64 deadline = G_MAXINT64;
+  for (const Entry& entry : entries_) {
+    if (!entry.clock)
+      deadline = std::min(deadline, entry.deadline);
+  }
+  if (timer_ > 0 && deadline == timer_deadline_)
+    return;
+  if (timer_ > 0) {
+    g_source_remove(timer_);
+    timer_ = 0;
+  }
+  if (deadline == G_MAXINT64)
+    return;
+  gint64 delay = std::max<gint64>(0, deadline - g_get_monotonic_time());
+  timer_deadline_ = deadline;
+  timer_ = g_timeout_add(static_cast<guint>((delay + 999) / 1000),
+                         reinterpret_cast<GSourceFunc>(OnTimer), this);
+}
+
+// static
+gboolean FrameClock::OnTimer(FrameClock* self) {
+  self->timer_ = 0;
+  gint64 now = g_get_monotonic_time();
+  for (auto it = self->entries_.begin(); it != self->entries_.end();) {
+    if (it->clock || it->deadline > now) {
+      ++it;
+      continue;
+    }
+    // Skip widgets that can not be seen, they resume when drawn.
+    GdkFrameClock* clock = gtk_widget_get_frame_clock(it->widget);
+    if (!clock || !IsWidgetVisibleInViewport(it->widget)) {
+      it = self->entries_.erase(it);
+      continue;
+    }
+    it->clock = clock;
+    if (std::none_of(self->connections_.begin(), self->connections_.end(),
+                     [clock](const Connection& c) {
+                       return c.clock == clock;
+                     })) {
+      g_object_ref(clock);
+      gulong signal = g_signal_connect(clock, "update",
+                                       G_CALLBACK(OnUpdate), self);
+      self->connections_.push_back({clock, signal});
+    }
+    gdk_frame_clock_request_phase(clock, GDK_FRAME_CLOCK_PHASE_UPDATE);
+    ++it;
+  }
+  self->UpdateTimer();
+  return G_SOURCE_REMOVE;
+}
+
+// static
+void FrameClock::OnUpdate(GdkFrameClock* clock, FrameClock* self) {
+  self->Disconnect(clock);
+  // Run the callbacks one by one, since a callback may schedule again or
+  // cancel others. New entries have no clock so they are not matched.
+  while (true) {
+    auto it = std::find_if(self->entries_.begin(), self->entries_.end(),
+                           [clock](const Entry& e) {
+                             return e.clock == clock;
+                           });
+    if (it == self->entries_.end())
+      break;
+    Callback callback = std::move(it->callback);
+    self->entries_.erase(it);
+    callback();
+  }
+}
+
+}  // namespace nu
@@ -0,0 +1,82 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_GTK_UTIL_FRAME_CLOCK_H_
+#define NATIVEUI_GTK_UTIL_FRAME_CLOCK_H_
+
+#include <gtk/gtk.h>
+
+#include <functional>
+#include <vector>
+
+#include "base/macros.h"
+#include "nativeui/nativeui_export.h"
+
+namespace nu {
+
+// Drives the animations of all widgets with one shared timer, and runs the
+// callbacks in the update phase of the window's GdkFrameClock so frames are
+// painted in sync with the display.
+//
+// Widgets that are not visible in their viewports are skipped, and they must
+// schedule again when they get drawn.
+//
+// This class is managed by State.
+class NATIVEUI_EXPORT FrameClock {
+ public:
+  using Callback = std::function<void()>;
+
+  FrameClock();
+  ~FrameClock();
+
+  static FrameClock* GetCurrent();
+
+  // Run |callback| once after |delay| ms, replacing the pending callback of
+  // |widget|.
+  void Schedule(GtkWidget* widget, int delay, Callback callback);
+
+  // Remove the pending callback of |widget|.
+  void Cancel(GtkWidget* widget);
+
+  // Whether |widget| has a pending callback.
+  bool IsScheduled(GtkWidget* widget) const;
+
+ private:
+  struct Entry {
+    GtkWidget* widget;
+    Callback callback;
+    // Time in microseconds when the callback should run.
+    gint64 deadline;
+    // The frame clock that has been requested to update for this entry.
+    GdkFrameClock* clock;
+  };
+
+  // The connection to a frame clock's update signal.
+  struct Connection {
+    GdkFrameClock* clock;
+    gulong signal;
+  };
+
+  std::vector<Entry>::iterator Find(GtkWidget* widget);
+  void Disconnect(GdkFrameClock* clock);
+  void DisconnectIfUnused(GdkFrameClock* clock);
+
+  // Arm |timer_| for the earliest entry.
+  void UpdateTimer();
+
+  static gboolean OnTimer(FrameClock* self);
+  static void OnUpdate(GdkFrameClock* clock, FrameClock* self);
+
+  std::vector<Entry> entries_;
+  std::vector<Connection> connections_;
+
+  guint timer_ = 0;
+  gint64 timer_deadline_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(FrameClock);
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_GTK_UTIL_FRAME_CLOCK_H_
@@ -0,0 +1,85 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/gtk/util/frame_clock.h"
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class FrameClockTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    window_ = new nu::Window(nu::Window::Options());
+    window_->SetContentSize(nu::SizeF(100, 100));
+    view_ = new nu::Container;
+    window_->SetContentView(view_.get());
+    clock_ = nu::FrameClock::GetCurrent();
+  }
+
+  // Run the message loop until quit or timeout.
+  void RunLoop(int timeout) {
+    bool timed_out = false;
+    nu::MessageLoop::TimerId timer = nu::MessageLoop::SetTimeout(
+        timeout, [&timed_out]() {
+          timed_out = true;
+          nu::MessageLoop::Quit();
+        });
+    nu::MessageLoop::Run();
+    if (!timed_out)
+      nu::MessageLoop::ClearTimeout(timer);
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  scoped_refptr<nu::Window> window_;
+  scoped_refptr<nu::Container> view_;
+  nu::FrameClock* clock_;
+};
+
+TEST_F(FrameClockTest, ScheduleAndCancel) {
+  GtkWidget* widget = view_->GetNative();
+  clock_->Schedule(widget, 1000, []() {});
+  EXPECT_TRUE(clock_->IsScheduled(widget));
+  clock_->Cancel(widget);
+  EXPECT_FALSE(clock_->IsScheduled(widget));
+}
+
+TEST_F(FrameClockTest, ReplacePendingCallback) {
+  window_->SetVisible(true);
+  GtkWidget* widget = view_->GetNative();
+  int first = 0;
+  int second = 0;
+  clock_->Schedule(widget, 0, [&]() { ++first; });
+  clock_->Schedule(widget, 10, [&]() {
+    ++second;
+    nu::MessageLoop::Quit();
+  });
+  RunLoop(2000);
+  EXPECT_EQ(first, 0);
+  EXPECT_EQ(second, 1);
+  EXPECT_FALSE(clock_->IsScheduled(widget));
+}
+
+TEST_F(FrameClockTest, ScheduleFromCallback) {
+  window_->SetVisible(true);
+  GtkWidget* widget = view_->GetNative();
+  int count = 0;
+  std::function<void()> callback = [&]() {
+    if (++count == 3)
+      nu::MessageLoop::Quit();
+    else
+      clock_->Schedule(widget, 10, callback);
+  };
+  clock_->Schedule(widget, 10, callback);
+  RunLoop(2000);
+  EXPECT_EQ(count, 3);
+}
+
+TEST_F(FrameClockTest, SkipHiddenWidget) {
+  GtkWidget* widget = view_->GetNative();
+  bool called = false;
+  clock_->Schedule(widget, 0, [&]() { called = true; });
+  RunLoop(100);
+  EXPECT_FALSE(called);
+  EXPECT_FALSE(clock_->IsScheduled(widget));
+}
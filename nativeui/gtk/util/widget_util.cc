@@ -40,6 +40,29 @@ SizeF GetPreferredSizeForWidget(GtkWidget* widget) {
   return SizeF(size.width, size.height);
 }
 
+bool IsWidgetVisibleInViewport(GtkWidget* widget) {
+  if (!gtk_widget_is_drawable(widget))
+    return false;
+  GdkRectangle rect = { 0, 0,
+                        gtk_widget_get_allocated_width(widget),
+                        gtk_widget_get_allocated_height(widget) };
+  for (GtkWidget* parent = gtk_widget_get_parent(widget); parent;
+       parent = gtk_widget_get_parent(parent)) {
+    if (!GTK_IS_VIEWPORT(parent) && !gtk_widget_is_toplevel(parent))
+      continue;
+    GdkRectangle bounds = rect;
+    if (!gtk_widget_translate_coordinates(widget, parent, 0, 0,
+                                          &bounds.x, &bounds.y))
+      return false;
+    GdkRectangle visible = { 0, 0,
+                             gtk_widget_get_allocated_width(parent),
+                             gtk_widget_get_allocated_height(parent) };
+    if (!gdk_rectangle_intersect(&bounds, &visible, nullptr))
+      return false;
+  }
+  return true;
+}
+
 void ApplyStyle(GtkWidget* widget,
                 base::StringPiece name,
                 base::StringPiece style) {
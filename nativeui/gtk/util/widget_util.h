@@ -18,6 +18,9 @@ bool GtkVersionCheck(int major = 0, int minor = 0, int micro = 0);
 
 SizeF GetPreferredSizeForWidget(NativeView widget);
 
+// Whether |widget| is drawn and not scrolled out of its viewports.
+bool IsWidgetVisibleInViewport(GtkWidget* widget);
+
 // Apply CSS |style| on |widget|, the style with same |name| will be
 // overwritten.
 void ApplyStyle(GtkWidget* widget,
@@ -28,10 +28,22 @@ View* g_grabbed_view = nullptr;
 
 // View private data.
 struct NUViewPrivate {
+  ~NUViewPrivate() {
+    if (pending_motion)
+      gdk_event_free(pending_motion);
+  }
+
   View* delegate;
   // Current view size.
   Size size;
 
+  // The last mouse move waiting for next frame.
+  GdkEvent* pending_motion = nullptr;
+  // Positions of the mouse moves coalesced before the pending one.
+  std::vector<PointF> motion_history;
+  // The tick callback that delivers the pending mouse move.
+  guint motion_tick_id = 0;
+
   // The current drop session (dest).
   GdkDragContext* drop_context = nullptr;
   // The registerd accepted dragged types for the view.
@@ -80,6 +92,47 @@ void OnRealize(GtkWidget* widget, View* view) {
     NUSetCursor(widget, view->cursor()->GetNative());
 }
 
+// Deliver the pending mouse move.
+void FlushMouseMove(GtkWidget* widget, NUViewPrivate* priv) {
+  if (priv->motion_tick_id) {
+    gtk_widget_remove_tick_callback(widget, priv->motion_tick_id);
+    priv->motion_tick_id = 0;
+  }
+  if (!priv->pending_motion)
+    return;
+  GdkEvent* event = priv->pending_motion;
+  priv->pending_motion = nullptr;
+  MouseEvent mouse_event(event, widget);
+  mouse_event.history.swap(priv->motion_history);
+  priv->delegate->on_mouse_move.Emit(priv->delegate, mouse_event);
+  gdk_event_free(event);
+}
+
+gboolean OnMouseMoveTick(GtkWidget* widget,
+                         GdkFrameClock* frame_clock,
+                         gpointer data) {
+  auto* priv = static_cast<NUViewPrivate*>(data);
+  priv->motion_tick_id = 0;
+  FlushMouseMove(widget, priv);
+  return G_SOURCE_REMOVE;
+}
+
+// Keep the mouse move until next frame, and record the position of the one it
+// replaces.
+void CoalesceMouseMove(GtkWidget* widget, GdkEvent* event) {
+  auto* priv = static_cast<NUViewPrivate*>(
+      g_object_get_data(G_OBJECT(widget), "private"));
+  if (priv->pending_motion) {
+    priv->motion_history.push_back(
+        MouseEvent(priv->pending_motion, widget).position_in_view);
+    gdk_event_free(priv->pending_motion);
+  }
+  priv->pending_motion = gdk_event_copy(event);
+  if (!priv->motion_tick_id)
+    priv->motion_tick_id = gtk_widget_add_tick_callback(
+        widget, OnMouseMoveTick, priv, nullptr);
+}
+
 gboolean OnMouseMove(GtkWidget* widget, GdkEvent* event, View* view) {
   // If user is dragging a widget that supports mouseDownMoveWindow, then we
   // need to move the window.
@@ -97,7 +150,10 @@ gboolean OnMouseMove(GtkWidget* widget, GdkEvent* event, View* view) {
 
   // Otherwise dispatch the event.
   if (!view->on_mouse_move.IsEmpty()) {
-    view->on_mouse_move.Emit(view, MouseEvent(event, widget));
+    if (view->IsMouseMoveCoalescing())
+      CoalesceMouseMove(widget, event);
+    else
+      view->on_mouse_move.Emit(view, MouseEvent(event, widget));
     return false;
   }
 
@@ -105,6 +161,11 @@ gboolean OnMouseMove(GtkWidget* widget, GdkEvent* event, View* view) {
 }
 
 gboolean OnMouseEvent(GtkWidget* widget, GdkEvent* event, View* view) {
+  // Keep the order of events when there is a pending mouse move.
+  auto* priv = static_cast<NUViewPrivate*>(
+      g_object_get_data(G_OBJECT(widget), "private"));
+  if (priv->pending_motion)
+    FlushMouseMove(widget, priv);
   switch (event->any.type) {
     case GDK_BUTTON_PRESS:
       return view->on_mouse_down.Emit(view, MouseEvent(event, widget));
@@ -0,0 +1,115 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <gtk/gtk.h>
+
+#include <string>
+#include <vector>
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class ViewGtkTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    window_ = new nu::Window(nu::Window::Options());
+    window_->SetContentSize(nu::SizeF(100, 100));
+    view_ = new nu::Container;
+    view_->SetMouseMoveCoalescing(true);
+    window_->SetContentView(view_.get());
+  }
+
+  void SendMouseMove(double x, double y) {
+    GdkEvent* event = gdk_event_new(GDK_MOTION_NOTIFY);
+    event->motion.x = x;
+    event->motion.y = y;
+    SendEvent("motion-notify-event", event);
+  }
+
+  void SendMouseDown(double x, double y) {
+    GdkEvent* event = gdk_event_new(GDK_BUTTON_PRESS);
+    event->button.button = 1;
+    event->button.x = x;
+    event->button.y = y;
+    SendEvent("button-press-event", event);
+  }
+
+  void SendEvent(const char* signal, GdkEvent* event) {
+    gboolean handled = FALSE;
+    g_signal_emit_by_name(view_->GetNative(), signal, event, &handled);
+    gdk_event_free(event);
+  }
+
+  // Run the message loop until quit or timeout.
+  void RunLoop(int timeout) {
+    bool timed_out = false;
+    nu::MessageLoop::TimerId timer = nu::MessageLoop::SetTimeout(
+        timeout, [&timed_out]() {
+          timed_out = true;
+          nu::MessageLoop::Quit();
+        });
+    nu::MessageLoop::Run();
+    if (!timed_out)
+      nu::MessageLoop::ClearTimeout(timer);
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  scoped_refptr<nu::Window> window_;
+  scoped_refptr<nu::Container> view_;
+};
+
+TEST_F(ViewGtkTest, CoalesceMouseMovesInFrame) {
+  window_->SetVisible(true);
+  int count = 0;
+  nu::PointF position;
+  view_->on_mouse_move.Connect([&](nu::View*, const nu::MouseEvent& event) {
+    ++count;
+    position = event.position_in_view;
+    nu::MessageLoop::Quit();
+  });
+  SendMouseMove(10, 10);
+  SendMouseMove(20, 20);
+  SendMouseMove(30, 30);
+  EXPECT_EQ(count, 0);
+  RunLoop(2000);
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(position, nu::PointF(30, 30));
+}
+
+TEST_F(ViewGtkTest, CoalescedMouseMovesHistory) {
+  window_->SetVisible(true);
+  std::vector<nu::PointF> history;
+  view_->on_mouse_move.Connect([&](nu::View*, const nu::MouseEvent& event) {
+    history = event.history;
+    nu::MessageLoop::Quit();
+  });
+  SendMouseMove(10, 10);
+  SendMouseMove(20, 20);
+  SendMouseMove(30, 30);
+  RunLoop(2000);
+  std::vector<nu::PointF> expected = {nu::PointF(10, 10), nu::PointF(20, 20)};
+  EXPECT_EQ(history, expected);
+}
+
+TEST_F(ViewGtkTest, MouseDownFlushesPendingMouseMove) {
+  std::vector<std::string> events;
+  view_->on_mouse_move.Connect([&](nu::View*, const nu::MouseEvent& event) {
+    EXPECT_EQ(event.position_in_view, nu::PointF(20, 20));
+    events.push_back("move");
+  });
+  view_->on_mouse_down.Connect([&](nu::View*, const nu::MouseEvent& event) {
+    events.push_back("down");
+    return false;
+  });
+  SendMouseMove(10, 10);
+  SendMouseMove(20, 20);
+  SendMouseDown(20, 20);
+  std::vector<std::string> expected = {"move", "down"};
+  EXPECT_EQ(events, expected);
+  // The flushed mouse move is not delivered again in next frame.
+  window_->SetVisible(true);
+  RunLoop(100);
+  EXPECT_EQ(events, expected);
+}
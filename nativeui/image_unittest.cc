@@ -0,0 +1,168 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/path_service.h"
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class ImageTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    base::FilePath exe_path;
+    base::PathService::Get(base::FILE_EXE, &exe_path);
+    path_ = exe_path.DirName().DirName().DirName()
+                    .Append(FILE_PATH_LITERAL("nativeui"))
+                    .Append(FILE_PATH_LITERAL("test"))
+                    .Append(FILE_PATH_LITERAL("fixtures"))
+                    .Append(FILE_PATH_LITERAL("static.png"));
+  }
+
+  base::FilePath GetFixture(const char* name) {
+    return path_.DirName().AppendASCII(name);
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  base::FilePath path_;
+};
+
+TEST_F(ImageTest, CreateFromPathAsync) {
+  scoped_refptr<nu::Image> image;
+  nu::Image::CreateFromPathAsync(path_, [&](scoped_refptr<nu::Image> result) {
+    image = result;
+    nu::MessageLoop::Quit();
+  });
+  EXPECT_FALSE(image);
+  nu::MessageLoop::Run();
+  ASSERT_TRUE(image);
+  EXPECT_FALSE(image->IsEmpty());
+  EXPECT_EQ(image->GetSize(), scoped_refptr<nu::Image>(
+      new nu::Image(path_))->GetSize());
+}
+
+TEST_F(ImageTest, CreateFromBufferAsync) {
+  std::string content;
+  ASSERT_TRUE(base::ReadFileToString(path_, &content));
+  scoped_refptr<nu::Image> image;
+  nu::Image::CreateFromBufferAsync(
+      nu::Buffer::Wrap(content.data(), content.size()), 2,
+      [&](scoped_refptr<nu::Image> result) {
+        image = result;
+        nu::MessageLoop::Quit();
+      });
+  // The buffer is copied so it can be released immediately.
+  content.clear();
+  nu::MessageLoop::Run();
+  ASSERT_TRUE(image);
+  EXPECT_FALSE(image->IsEmpty());
+  EXPECT_EQ(image->GetScaleFactor(), 2);
+}
+
+TEST_F(ImageTest, CreateFromInvalidPathAsync) {
+  scoped_refptr<nu::Image> image;
+  nu::Image::CreateFromPathAsync(
+      path_.Append(FILE_PATH_LITERAL("invalid")),
+      [&](scoped_refptr<nu::Image> result) {
+        image = result;
+        nu::MessageLoop::Quit();
+      });
+  nu::MessageLoop::Run();
+  ASSERT_TRUE(image);
+  EXPECT_TRUE(image->IsEmpty());
+}
+
+TEST_F(ImageTest, CreateWithMaxSize) {
+  scoped_refptr<nu::Image> image =
+      new nu::Image(GetFixture("animated.gif"), nu::SizeF(5, 8));
+  ASSERT_FALSE(image->IsEmpty());
+  EXPECT_EQ(image->GetSize(), nu::SizeF(5, 5));
+}
+
+TEST_F(ImageTest, CreateWithMaxSizeDoesNotScaleUp) {
+  scoped_refptr<nu::Image> image = new nu::Image(path_, nu::SizeF(100, 100));
+  ASSERT_FALSE(image->IsEmpty());
+  EXPECT_EQ(image->GetSize(), nu::SizeF(1, 1));
+}
+
+TEST_F(ImageTest, GetDecodeSize) {
+  nu::SizeF max_size(100, 100);
+  EXPECT_EQ(nu::Image::GetDecodeSize(nu::Size(400, 200), max_size, 1),
+            nu::Size(100, 50));
+  EXPECT_EQ(nu::Image::GetDecodeSize(nu::Size(400, 200), max_size, 2),
+            nu::Size(200, 100));
+  EXPECT_EQ(nu::Image::GetDecodeSize(nu::Size(50, 50), max_size, 1),
+            nu::Size(50, 50));
+  EXPECT_EQ(nu::Image::GetDecodeSize(nu::Size(1000, 1), nu::SizeF(10, 10), 1),
+            nu::Size(10, 1));
+}
+
+TEST_F(ImageTest, CreateFromPixels) {
+  // 2x2 opaque pixels with padding at the end of each row.
+  const uint8_t pixels[] = {
+    0xFF, 0x00, 0x00, 0xFF,  0x00, 0xFF, 0x00, 0xFF,  0, 0, 0, 0,
+    0x00, 0x00, 0xFF, 0xFF,  0xFF, 0xFF, 0xFF, 0xFF,  0, 0, 0, 0,
+  };
+  scoped_refptr<nu::Image> image = new nu::Image(
+      nu::Buffer::Wrap(pixels, sizeof(pixels)), nu::Size(2, 2), 12,
+      nu::PixelFormat::RGBA, 2);
+  ASSERT_FALSE(image->IsEmpty());
+  EXPECT_EQ(image->GetSize(), nu::SizeF(1, 1));
+  // Draw the image and read it back.
+  scoped_refptr<nu::Canvas> canvas = new nu::Canvas(nu::SizeF(1, 1), 2);
+  canvas->GetPainter()->DrawImage(image.get(), nu::RectF(0, 0, 1, 1));
+  nu::Canvas::Pixels result = canvas->LockPixels();
+  const uint32_t* row1 = static_cast<const uint32_t*>(result.data.content());
+  const uint32_t* row2 = reinterpret_cast<const uint32_t*>(
+      static_cast<const uint8_t*>(result.data.content()) + result.stride);
+  EXPECT_EQ(row1[0] & 0xFFFFFF, 0xFF0000u);
+  EXPECT_EQ(row1[1] & 0xFFFFFF, 0x00FF00u);
+  EXPECT_EQ(row2[0] & 0xFFFFFF, 0x0000FFu);
+  EXPECT_EQ(row2[1] & 0xFFFFFF, 0xFFFFFFu);
+  canvas->UnlockPixels();
+}
+
+TEST_F(ImageTest, CreateFromInvalidPixels) {
+  const uint8_t pixels[12] = {0};
+  scoped_refptr<nu::Image> image = new nu::Image(
+      nu::Buffer::Wrap(pixels, sizeof(pixels)), nu::Size(2, 2), 8,
+      nu::PixelFormat::RGBA, 1);
+  EXPECT_TRUE(image->IsEmpty());
+}
+
+#if defined(OS_LINUX)
+TEST_F(ImageTest, AdvanceCachedFrames) {
+  scoped_refptr<nu::Image> image = new nu::Image(GetFixture("animated.gif"));
+  image->AdvanceFrame();
+  cairo_surface_t* surface = image->GetCairoSurface();
+  ASSERT_TRUE(surface);
+  EXPECT_EQ(cairo_image_surface_get_width(surface), 10);
+  EXPECT_GE(image->GetFrameDelay(), 0);
+  // Frames are pre-rendered so the surface is reused when drawing again.
+  EXPECT_EQ(image->GetCairoSurface(), surface);
+  cairo_surface_t* scaled = image->GetScaledCairoSurface(nu::Size(20, 20));
+  EXPECT_EQ(image->GetScaledCairoSurface(nu::Size(20, 20)), scaled);
+}
+
+TEST_F(ImageTest, StopAfterLoopCount) {
+  std::string content;
+  ASSERT_TRUE(base::ReadFileToString(GetFixture("animated.gif"), &content));
+  // Change the loop count of the NETSCAPE2.0 extension to 1.
+  size_t pos = content.find("NETSCAPE2.0");
+  ASSERT_NE(pos, std::string::npos);
+  content[pos + 13] = 1;
+  scoped_refptr<nu::Image> image = new nu::Image(
+      nu::Buffer::Wrap(content.data(), content.size()), 1.f);
+  // The 30 frames of 30ms should end in about 900ms.
+  image->AdvanceFrame();
+  int delay = 0;
+  for (int i = 0; i < 200 && delay >= 0; ++i) {
+    g_usleep(10 * 1000);
+    image->AdvanceFrame();
+    delay = image->GetFrameDelay();
+  }
+  EXPECT_EQ(delay, -1);
+}
+#endif
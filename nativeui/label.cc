@@ -9,6 +9,7 @@
 #include "nativeui/app.h"
 #include "nativeui/gfx/attributed_text.h"
 #include "nativeui/gfx/font.h"
+#include "nativeui/gfx/text_layout_cache.h"
 #include "third_party/yoga/Yoga.h"
 
 namespace nu {
@@ -19,10 +20,8 @@ YGSize MeasureLabel(YGNodeRef node,
                     float width, YGMeasureMode mode,
                     float height, YGMeasureMode height_mode) {
   auto* label = static_cast<Label*>(YGNodeGetContext(node));
-  SizeF size = label->GetAttributedText()
-                    ->GetBoundsFor(SizeF(width, height)).size();
-  size.Enlarge(1, 1);  // leave space for border
-  return {std::ceil(size.width()), std::ceil(size.height())};
+  SizeF size = label->MeasureContent(width, height);
+  return {size.width(), size.height()};
 }
 
 }  // namespace
@@ -31,16 +30,18 @@ YGSize MeasureLabel(YGNodeRef node,
 const char Label::kClassName[] = "Label";
 
 Label::Label(const std::string& text)
-    : text_(new AttributedText(text, TextFormat({TextAlign::Center,
-                                                 TextAlign::Center,
-                                                 true, false}))),
+    : is_text_shared_(true),
+      attributes_(TextFormat({TextAlign::Center, TextAlign::Center,
+                              true, false})),
       use_system_color_(true),
       system_color_(Color::Get(Color::Name::Text)) {
+  UpdateSharedText(text);
   Init();
 }
 
 Label::Label(scoped_refptr<AttributedText> text)
     : text_(std::move(text)),
+      is_text_shared_(false),
       use_system_color_(false) {
   Init();
 }
@@ -48,7 +49,10 @@ Label::Label(scoped_refptr<AttributedText> text)
 Label::~Label() {}
 
 void Label::SetText(const std::string& text) {
-  text_->SetText(text);
+  if (is_text_shared_)
+    UpdateSharedText(text);
+  else
+    text_->SetText(text);
   MarkDirty();
 }
 
@@ -57,32 +61,56 @@ std::string Label::GetText() const {
 }
 
 void Label::SetAlign(TextAlign align) {
-  TextFormat format = text_->GetFormat();
-  format.align = align;
-  text_->SetFormat(std::move(format));
+  if (is_text_shared_) {
+    attributes_.align = align;
+    UpdateSharedText(GetText());
+  } else {
+    TextFormat format = text_->GetFormat();
+    format.align = align;
+    text_->SetFormat(std::move(format));
+  }
   MarkDirty();
 }
 
 void Label::SetVAlign(TextAlign align) {
-  TextFormat format = text_->GetFormat();
-  format.valign = align;
-  text_->SetFormat(std::move(format));
+  if (is_text_shared_) {
+    attributes_.valign = align;
+    UpdateSharedText(GetText());
+  } else {
+    TextFormat format = text_->GetFormat();
+    format.valign = align;
+    text_->SetFormat(std::move(format));
+  }
   MarkDirty();
 }
 
 void Label::SetAttributedText(scoped_refptr<AttributedText> text) {
   use_system_color_ = false;
+  is_text_shared_ = false;
   text_ = std::move(text);
   MarkDirty();
 }
 
+AttributedText* Label::GetMutableAttributedText() {
+  if (is_text_shared_) {
+    is_text_shared_ = false;
+    text_ = new AttributedText(GetText(), attributes_);
+  }
+  return text_.get();
+}
+
 void Label::UpdateColor() {
   if (!use_system_color_)
     return;
   Color color = Color::Get(Color::Name::Text);
   if (color == system_color_)
     return;
-  text_->SetColor(color);
+  if (is_text_shared_) {
+    attributes_.color = color;
+    UpdateSharedText(GetText());
+  } else {
+    text_->SetColor(color);
+  }
   system_color_ = color;
 }
 
@@ -96,20 +124,40 @@ void Label::MarkDirty() {
   SchedulePaint();
 }
 
+void Label::UpdateSharedText(const std::string& text) {
+  text_ = TextLayoutCache::GetCurrent()->Get(text, attributes_);
+}
+
 const char* Label::GetClassName() const {
   return kClassName;
 }
 
 void Label::SetFont(scoped_refptr<Font> font) {
-  text_->SetFont(font);
+  if (is_text_shared_) {
+    attributes_.font = font;
+    UpdateSharedText(GetText());
+  } else {
+    text_->SetFont(font);
+  }
   View::SetFont(std::move(font));
   MarkDirty();  // layout has changed
 }
 
 void Label::SetColor(Color color) {
   use_system_color_ = false;
-  text_->SetColor(color);
+  if (is_text_shared_) {
+    attributes_.color = color;
+    UpdateSharedText(GetText());
+  } else {
+    text_->SetColor(color);
+  }
   View::SetColor(color);
 }
 
+SizeF Label::MeasureContent(float width, float height) const {
+  SizeF size = text_->GetBoundsFor(SizeF(width, height)).size();
+  size.Enlarge(1, 1);  // leave space for border
+  return SizeF(std::ceil(size.width()), std::ceil(size.height()));
+}
+
 }  // namespace nu
@@ -28,7 +28,15 @@ class NATIVEUI_EXPORT Label : public View {
   void SetVAlign(TextAlign align);
 
   void SetAttributedText(scoped_refptr<AttributedText> text);
-  AttributedText* GetAttributedText() const { return text_.get(); }
+  const AttributedText* GetAttributedText() const { return text_.get(); }
+
+  // Return the attributed text for modification, the label gets its own copy
+  // first if the text is shared.
+  AttributedText* GetMutableAttributedText();
+
+  // Internal: Return the text to draw, which may be shared with other labels
+  // and must not be modified.
+  AttributedText* GetTextLayout() const { return text_.get(); }
 
   // Internal: Make sure the label is using system text color.
   void UpdateColor();
@@ -37,6 +45,7 @@ class NATIVEUI_EXPORT Label : public View {
   const char* GetClassName() const override;
   void SetFont(scoped_refptr<Font> font) override;
   void SetColor(Color color) override;
+  SizeF MeasureContent(float width, float height) const override;
 
  protected:
   ~Label() override;
@@ -47,10 +56,18 @@ class NATIVEUI_EXPORT Label : public View {
   // Mark the yoga node as dirty.
   void MarkDirty();
 
+  // Replace the shared text with the layout for current attributes.
+  void UpdateSharedText(const std::string& text);
+
   NativeView PlatformCreate();
 
   scoped_refptr<AttributedText> text_;
 
+  // Plain labels share layouts of same text through TextLayoutCache, and the
+  // text is copied before being exposed for modification.
+  bool is_text_shared_;
+  TextAttributes attributes_;
+
   bool use_system_color_;
   Color system_color_;
 };
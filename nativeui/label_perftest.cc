@@ -0,0 +1,45 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <vector>
+
+#include "base/strings/string_number_conversions.h"
+#include "nativeui/nativeui.h"
+#include "nativeui/test/perf_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class LabelPerfTest : public testing::Test {
+ protected:
+  nu::Lifetime lifetime_;
+  nu::State state_;
+};
+
+TEST_F(LabelPerfTest, Measure) {
+  for (int views : nu::kPerfTreeSizes) {
+    std::vector<scoped_refptr<nu::Label>> labels;
+    labels.reserve(views);
+    for (int i = 0; i < views; ++i)
+      labels.push_back(new nu::Label("Label " + base::NumberToString(i)));
+
+    nu::PerfTimer timer;
+    for (const auto& label : labels)
+      label->GetTextLayout()->GetBoundsFor(nu::SizeF(100, 100));
+    nu::PrintPerfResult("Label.Measure", views, timer.Elapsed());
+  }
+}
+
+TEST_F(LabelPerfTest, SetTextLayout) {
+  for (int views : nu::kPerfTreeSizes) {
+    scoped_refptr<nu::Container> root = new nu::Container;
+    root->SetBounds(nu::RectF(0, 0, 800, 600));
+    nu::BuildWideTree(root.get(), views);
+
+    nu::PerfTimer timer;
+    for (int i = 0; i < root->ChildCount(); i += views / 100) {
+      static_cast<nu::Label*>(root->ChildAt(i))->SetText(
+          "Changed " + base::NumberToString(i));
+    }
+    nu::PrintPerfResult("Label.SetTextLayout", views, timer.Elapsed());
+  }
+}
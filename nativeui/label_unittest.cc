@@ -32,3 +32,18 @@ TEST_F(LabelTest, UpdateStyle) {
   EXPECT_EQ(height.value, YGNodeStyleGetMinHeight(label_->node()).value);
 }
 #endif
+
+TEST_F(LabelTest, ShareTextLayout) {
+  scoped_refptr<nu::Label> label = new nu::Label;
+  label->SetText("test");
+  label_->SetText("test");
+  EXPECT_EQ(label->GetTextLayout(), label_->GetTextLayout());
+  // Reading the text does not copy it.
+  EXPECT_EQ(label->GetAttributedText(), label_->GetTextLayout());
+  // Modifying the text of one label does not affect others.
+  label->GetMutableAttributedText()->SetText("changed");
+  EXPECT_EQ(label->GetText(), "changed");
+  EXPECT_EQ(label_->GetText(), "test");
+  label->SetText("test");
+  EXPECT_NE(label->GetTextLayout(), label_->GetTextLayout());
+}
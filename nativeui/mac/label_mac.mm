@@ -25,7 +25,7 @@
 
   auto* label = static_cast<nu::Label*>([self shell]);
   label->UpdateColor();
-  painter.DrawAttributedText(label->GetAttributedText(),
+  painter.DrawAttributedText(label->GetTextLayout(),
                              nu::RectF(nu::SizeF([self frame].size)));
 }
 
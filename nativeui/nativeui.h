@@ -20,9 +20,16 @@
 #include "nativeui/gfx/attributed_text.h"
 #include "nativeui/gfx/canvas.h"
 #include "nativeui/gfx/font.h"
+#include "nativeui/gfx/font_registry.h"
 #include "nativeui/gfx/geometry/insets.h"
 #include "nativeui/gfx/image.h"
+#include "nativeui/gfx/image_cache.h"
 #include "nativeui/gfx/painter.h"
+#include "nativeui/gfx/path.h"
+#include "nativeui/gfx/pixel_format.h"
+#include "nativeui/gfx/recording.h"
+#include "nativeui/gfx/text_layout_cache.h"
+#include "nativeui/gfx/text_measurer.h"
 #include "nativeui/gif_player.h"
 #include "nativeui/group.h"
 #include "nativeui/label.h"
@@ -39,6 +46,7 @@
 #include "nativeui/separator.h"
 #include "nativeui/slider.h"
 #include "nativeui/state.h"
+#include "nativeui/style_sheet.h"
 #include "nativeui/tab.h"
 #include "nativeui/table.h"
 #include "nativeui/table_model.h"
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <utility>
 #include <vector>
 
@@ -21,10 +22,21 @@ class SignalDelegate {
 };
 
 // A simple signal/slot implementation.
+//
+// Emitting does not copy the list of slots: slots connected during emission
+// are kept aside, and disconnected slots are only marked, until the outermost
+// emission is done. Only the slot being called is copied, so it stays alive
+// even if it destroys the signal.
 template<typename Sig> class SignalBase {
  public:
   using Slot = std::function<Sig>;
 
+  ~SignalBase() {
+    // Tell the running emissions to stop touching this signal.
+    if (destroyed_)
+      *destroyed_ = true;
+  }
+
   void SetDelegate(SignalDelegate* delegate, int identifier = 0) {
     delegate_ = delegate;
     identifier_ = identifier;
@@ -33,33 +45,113 @@ template<typename Sig> class SignalBase {
   int Connect(const Slot& slot) {
     if (delegate_)
       delegate_->OnConnect(identifier_);
-    slots_.push_back(std::make_pair(++next_id_, slot));
+    if (emit_depth_ > 0)
+      pending_slots_.push_back({++next_id_, false, slot});
+    else
+      slots_.push_back({++next_id_, false, slot});
     return next_id_;
   }
 
   void Disconnect(int id) {
     auto iter = std::lower_bound(slots_.begin(), slots_.end(),
-                                 id, TupleCompare);
-    if (iter != slots_.end() && std::get<0>(*iter) == id)
-      slots_.erase(iter);
+                                 id, SlotCompare);
+    if (iter != slots_.end() && iter->id == id) {
+      if (emit_depth_ == 0) {
+        slots_.erase(iter);
+      } else if (!iter->removed) {
+        // The slot might be running, destroy it after emission.
+        iter->removed = true;
+        ++removed_count_;
+      }
+      return;
+    }
+    iter = std::lower_bound(pending_slots_.begin(), pending_slots_.end(),
+                            id, SlotCompare);
+    if (iter != pending_slots_.end() && iter->id == id)
+      pending_slots_.erase(iter);
   }
 
   void DisconnectAll() {
-    slots_.clear();
+    pending_slots_.clear();
+    if (emit_depth_ == 0) {
+      slots_.clear();
+      return;
+    }
+    for (auto& slot : slots_)
+      slot.removed = true;
+    removed_count_ = slots_.size();
   }
 
   bool IsEmpty() const {
-    return slots_.empty();
+    return slots_.size() == removed_count_ && pending_slots_.empty();
   }
 
  protected:
-  // Use the first element of tuple as comparing key.
-  static bool TupleCompare(const std::pair<int, Slot>& element, int key) {
-    return element.first < key;
+  struct SlotEntry {
+    int id;
+    bool removed;
+    Slot slot;
+  };
+
+  // Keeps the slots in place during emission, and applies the changes made
+  // during emission after the outermost one.
+  class EmitScope {
+   public:
+    explicit EmitScope(SignalBase* signal)
+        : signal_(signal), previous_(signal->destroyed_) {
+      ++signal_->emit_depth_;
+      signal_->destroyed_ = &destroyed_;
+    }
+
+    ~EmitScope() {
+      if (destroyed_) {
+        if (previous_)
+          *previous_ = true;
+        return;
+      }
+      signal_->destroyed_ = previous_;
+      if (--signal_->emit_depth_ == 0)
+        signal_->ApplyPendingChanges();
+    }
+
+    // Whether the signal has been destroyed by a slot.
+    bool destroyed() const { return destroyed_; }
+
+   private:
+    SignalBase* signal_;
+    bool* previous_;
+    bool destroyed_ = false;
+  };
+
+  // Use the id as comparing key.
+  static bool SlotCompare(const SlotEntry& element, int key) {
+    return element.id < key;
+  }
+
+  void ApplyPendingChanges() {
+    if (removed_count_ > 0) {
+      slots_.erase(std::remove_if(slots_.begin(), slots_.end(),
+                                  [](const SlotEntry& e) { return e.removed; }),
+                   slots_.end());
+      removed_count_ = 0;
+    }
+    if (!pending_slots_.empty()) {
+      std::move(pending_slots_.begin(), pending_slots_.end(),
+                std::back_inserter(slots_));
+      pending_slots_.clear();
+    }
   }
 
   int next_id_ = 0;
-  std::vector<std::pair<int, Slot>> slots_;
+  std::vector<SlotEntry> slots_;
+
+  // Slots connected during emission.
+  std::vector<SlotEntry> pending_slots_;
+  size_t removed_count_ = 0;
+  int emit_depth_ = 0;
+
+  // Points to the flag of innermost emission.
+  bool* destroyed_ = nullptr;
 
   int identifier_ = 0;
   SignalDelegate* delegate_ = nullptr;
@@ -72,11 +164,17 @@ template<typename... Args>
 class Signal<void(Args...)> : public SignalBase<void(Args...)> {
  public:
   void Emit(Args... args) {
-    // Copy the list before iterating, since it is possible that user removes
-    // elements from the list when iterating.
-    auto slots = this->slots_;
-    for (auto& slot : slots)
-      slot.second(std::forward<Args>(args)...);
+    typename SignalBase<void(Args...)>::EmitScope scope(this);
+    // Slots connected during emission are not called.
+    size_t count = this->slots_.size();
+    for (size_t i = 0; i < count; ++i) {
+      if (this->slots_[i].removed)
+        continue;
+      auto slot = this->slots_[i].slot;
+      slot(std::forward<Args>(args)...);
+      if (scope.destroyed())
+        return;
+    }
   }
 };
 
@@ -85,12 +183,17 @@ template<typename... Args>
 class Signal<bool(Args...)> : public SignalBase<bool(Args...)> {
  public:
   bool Emit(Args... args) {
-    // Copy the list before iterating, since it is possible that user removes
-    // elements from the list when iterating.
-    auto slots = this->slots_;
-    for (auto& slot : slots) {
-      if (slot.second(std::forward<Args>(args)...))
+    typename SignalBase<bool(Args...)>::EmitScope scope(this);
+    // Slots connected during emission are not called.
+    size_t count = this->slots_.size();
+    for (size_t i = 0; i < count; ++i) {
+      if (this->slots_[i].removed)
+        continue;
+      auto slot = this->slots_[i].slot;
+      if (slot(std::forward<Args>(args)...))
         return true;
+      if (scope.destroyed())
+        return false;
     }
     return false;
   }
@@ -0,0 +1,47 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/signal.h"
+#include "nativeui/test/perf_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+// Numbers of connected slots.
+const int kSlotCounts[] = { 1, 10, 100, 1000 };
+
+// Number of emissions for each measurement.
+const int kEmitCount = 100000;
+
+}  // namespace
+
+TEST(SignalPerfTest, Emit) {
+  for (int slots : kSlotCounts) {
+    nu::Signal<void(int)> signal;
+    int sum = 0;
+    for (int i = 0; i < slots; ++i)
+      signal.Connect([&sum](int value) { sum += value; });
+
+    nu::PerfTimer timer;
+    for (int i = 0; i < kEmitCount; ++i)
+      signal.Emit(1);
+    nu::PrintPerfResult("Signal.Emit", "slots", slots, timer.Elapsed());
+    EXPECT_EQ(sum, slots * kEmitCount);
+  }
+}
+
+TEST(SignalPerfTest, EmitBool) {
+  for (int slots : kSlotCounts) {
+    nu::Signal<bool(int)> signal;
+    int count = 0;
+    for (int i = 0; i < slots; ++i)
+      signal.Connect([&count](int value) { ++count; return false; });
+
+    nu::PerfTimer timer;
+    for (int i = 0; i < kEmitCount; ++i)
+      signal.Emit(1);
+    nu::PrintPerfResult("Signal.EmitBool", "slots", slots, timer.Elapsed());
+    EXPECT_EQ(count, slots * kEmitCount);
+  }
+}
@@ -0,0 +1,136 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <memory>
+
+#include "nativeui/signal.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+TEST(SignalTest, Emit) {
+  nu::Signal<void(int)> signal;
+  int sum = 0;
+  signal.Connect([&sum](int value) { sum += value; });
+  signal.Connect([&sum](int value) { sum += value * 10; });
+  signal.Emit(1);
+  EXPECT_EQ(sum, 11);
+}
+
+TEST(SignalTest, EmitBool) {
+  nu::Signal<bool(int)> signal;
+  int count = 0;
+  signal.Connect([&count](int) { ++count; return true; });
+  signal.Connect([&count](int) { ++count; return true; });
+  EXPECT_TRUE(signal.Emit(1));
+  EXPECT_EQ(count, 1);
+}
+
+TEST(SignalTest, Disconnect) {
+  nu::Signal<void()> signal;
+  int count = 0;
+  int id = signal.Connect([&count]() { ++count; });
+  signal.Disconnect(id);
+  signal.Emit();
+  EXPECT_EQ(count, 0);
+  EXPECT_TRUE(signal.IsEmpty());
+}
+
+TEST(SignalTest, DisconnectSelfWhenEmitting) {
+  nu::Signal<void()> signal;
+  int count = 0;
+  int id = 0;
+  // The captured state must stay valid after disconnecting.
+  auto data = std::make_shared<int>(42);
+  id = signal.Connect([&signal, &id, &count, data]() {
+    signal.Disconnect(id);
+    count += *data;
+  });
+  signal.Emit();
+  signal.Emit();
+  EXPECT_EQ(count, 42);
+  EXPECT_TRUE(signal.IsEmpty());
+}
+
+TEST(SignalTest, DisconnectOthersWhenEmitting) {
+  nu::Signal<void()> signal;
+  int count = 0;
+  int id = 0;
+  signal.Connect([&signal, &id]() { signal.Disconnect(id); });
+  id = signal.Connect([&count]() { ++count; });
+  signal.Emit();
+  EXPECT_EQ(count, 0);
+  EXPECT_FALSE(signal.IsEmpty());
+}
+
+TEST(SignalTest, ConnectWhenEmitting) {
+  nu::Signal<void()> signal;
+  int count = 0;
+  signal.Connect([&signal, &count]() {
+    signal.Connect([&count]() { ++count; });
+  });
+  signal.Emit();
+  EXPECT_EQ(count, 0) << "Slots connected when emitting should not be called";
+  signal.Emit();
+  EXPECT_EQ(count, 1);
+}
+
+TEST(SignalTest, DisconnectAllWhenEmitting) {
+  nu::Signal<void()> signal;
+  int count = 0;
+  signal.Connect([&signal, &count]() {
+    ++count;
+    signal.DisconnectAll();
+  });
+  signal.Connect([&count]() { ++count; });
+  signal.Emit();
+  EXPECT_EQ(count, 1);
+  EXPECT_TRUE(signal.IsEmpty());
+}
+
+TEST(SignalTest, NestedEmit) {
+  nu::Signal<void(int)> signal;
+  int count = 0;
+  int id = 0;
+  signal.Connect([&signal, &count](int depth) {
+    ++count;
+    if (depth < 3)
+      signal.Emit(depth + 1);
+  });
+  id = signal.Connect([&signal, &id](int depth) {
+    if (depth == 3)
+      signal.Disconnect(id);
+  });
+  signal.Emit(0);
+  EXPECT_EQ(count, 4);
+  signal.Emit(3);
+  EXPECT_EQ(count, 5);
+}
+
+TEST(SignalTest, DestroyWhenEmitting) {
+  auto* signal = new nu::Signal<void()>;
+  int count = 0;
+  signal->Connect([&signal, &count]() {
+    ++count;
+    auto* to_delete = signal;
+    signal = nullptr;
+    delete to_delete;
+  });
+  signal->Connect([&count]() { ++count; });
+  signal->Emit();
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(signal, nullptr);
+}
+
+TEST(SignalTest, ReadCapturesAfterDestroyWhenEmitting) {
+  auto* signal = new nu::Signal<void()>;
+  auto value = std::make_shared<int>(42);
+  int read = 0;
+  signal->Connect([signal, value, &read]() {
+    delete signal;
+    // The captures must outlive the signal for the rest of the call.
+    read = *value;
+  });
+  value.reset();
+  signal->Emit();
+  EXPECT_EQ(read, 42);
+}
@@ -8,8 +8,12 @@
 #include "base/threading/thread_local.h"
 #include "nativeui/appearance.h"
 #include "nativeui/gfx/font.h"
+#include "nativeui/gfx/font_registry.h"
+#include "nativeui/gfx/image_cache.h"
+#include "nativeui/gfx/text_layout_cache.h"
 #include "nativeui/protocol_job.h"
 #include "nativeui/screen.h"
+#include "nativeui/util/worker_pool.h"
 #include "third_party/yoga/Yoga.h"
 
 #if defined(OS_WIN)
@@ -24,6 +28,7 @@
 #include "nativeui/win/util/tray_host.h"
 #elif defined(OS_LINUX)
 #include "nativeui/gfx/gtk/gtk_theme.h"
+#include "nativeui/gtk/util/frame_clock.h"
 #endif
 
 namespace nu {
@@ -62,6 +67,8 @@ State::State() : yoga_config_(YGConfigNew()) {
 }
 
 State::~State() {
+  // Wait for background tasks before destroying other states.
+  worker_pool_.reset();
   YGConfigFree(yoga_config_);
 
   if (g_main_state == this)
@@ -91,4 +98,28 @@ Appearance* State::GetAppearance() {
   return appearance_.get();
 }
 
+FontRegistry* State::GetFontRegistry() {
+  if (!font_registry_)
+    font_registry_.reset(new FontRegistry);
+  return font_registry_.get();
+}
+
+ImageCache* State::GetImageCache() {
+  if (!image_cache_)
+    image_cache_.reset(new ImageCache);
+  return image_cache_.get();
+}
+
+TextLayoutCache* State::GetTextLayoutCache() {
+  if (!text_layout_cache_)
+    text_layout_cache_.reset(new TextLayoutCache);
+  return text_layout_cache_.get();
+}
+
+WorkerPool* State::GetWorkerPool() {
+  if (!worker_pool_)
+    worker_pool_.reset(new WorkerPool);
+  return worker_pool_.get();
+}
+
 }  // namespace nu
@@ -26,7 +26,11 @@ namespace nu {
 
 class Appearance;
 class Font;
+class FontRegistry;
+class ImageCache;
 class Screen;
+class TextLayoutCache;
+class WorkerPool;
 
 #if defined(OS_WIN)
 class ClassRegistrar;
@@ -37,6 +41,7 @@ class ScopedOleInitializer;
 class TrayHost;
 class TimerHost;
 #elif defined(OS_LINUX)
+class FrameClock;
 class GtkTheme;
 #endif
 
@@ -64,6 +69,7 @@ class NATIVEUI_EXPORT State {
   TimerHost* GetTimerHost();
   UINT GetNextCommandID();
 #elif defined(OS_LINUX)
+  FrameClock* GetFrameClock();
   GtkTheme* GetGtkTheme();
 #endif
 
@@ -76,6 +82,18 @@ class NATIVEUI_EXPORT State {
   // Internal: Return the appearance object
   Appearance* GetAppearance();
 
+  // Internal: Return the registry of shared fonts.
+  FontRegistry* GetFontRegistry();
+
+  // Internal: Return the cache of decoded images.
+  ImageCache* GetImageCache();
+
+  // Internal: Return the cache of text layouts.
+  TextLayoutCache* GetTextLayoutCache();
+
+  // Internal: Return the pool of background threads.
+  WorkerPool* GetWorkerPool();
+
   // Internal: Return the default font.
   scoped_refptr<Font>& default_font() { return default_font_; }
 
@@ -102,6 +120,7 @@ class NATIVEUI_EXPORT State {
 #endif
 
 #if defined(OS_LINUX)
+  std::unique_ptr<FrameClock> frame_clock_;
   std::unique_ptr<GtkTheme> gtk_theme_;
 #endif
 
@@ -111,6 +130,10 @@ class NATIVEUI_EXPORT State {
 
   std::unique_ptr<Screen> screen_;
   std::unique_ptr<Appearance> appearance_;
+  std::unique_ptr<FontRegistry> font_registry_;
+  std::unique_ptr<ImageCache> image_cache_;
+  std::unique_ptr<TextLayoutCache> text_layout_cache_;
+  std::unique_ptr<WorkerPool> worker_pool_;
   scoped_refptr<Font> default_font_;
 
   // The app instance.
@@ -0,0 +1,71 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/style_sheet.h"
+
+#include <set>
+
+#include "nativeui/view.h"
+
+namespace nu {
+
+StyleSheet::StyleSheet() {}
+
+StyleSheet::~StyleSheet() {}
+
+void StyleSheet::SetStyleProperty(const std::string& name,
+                                  const std::string& value) {
+  std::string key(ParseStyleName(name));
+  if (key == "color") {
+    has_color_ = true;
+    color_ = Color(value);
+  } else if (key == "backgroundcolor") {
+    has_background_color_ = true;
+    background_color_ = Color(value);
+  } else {
+    YogaProperty property;
+    if (ParseYogaProperty(key, value, &property))
+      properties_.push_back(property);
+  }
+}
+
+void StyleSheet::SetStyleProperty(const std::string& name, float value) {
+  YogaProperty property;
+  if (ParseYogaProperty(ParseStyleName(name), value, &property))
+    properties_.push_back(property);
+}
+
+void StyleSheet::ApplyTo(View* view) const {
+  ApplyStyles(view);
+  view->Layout();
+}
+
+void StyleSheet::ApplyToViews(const std::vector<View*>& views) const {
+  // Views in the same tree share one layout.
+  std::set<View*> roots;
+  for (View* view : views) {
+    ApplyStyles(view);
+    View* root = view;
+    while (root->GetParent() && root->GetParent()->IsContainer())
+      root = root->GetParent();
+    roots.insert(root);
+  }
+  for (View* root : roots)
+    root->Layout();
+}
+
+size_t StyleSheet::GetPropertyCount() const {
+  return properties_.size() + has_color_ + has_background_color_;
+}
+
+void StyleSheet::ApplyStyles(View* view) const {
+  if (has_color_)
+    view->SetColor(color_);
+  if (has_background_color_)
+    view->SetBackgroundColor(background_color_);
+  for (const YogaProperty& property : properties_)
+    ApplyYogaProperty(view->node(), property);
+}
+
+}  // namespace nu
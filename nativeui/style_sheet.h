@@ -0,0 +1,71 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_STYLE_SHEET_H_
+#define NATIVEUI_STYLE_SHEET_H_
+
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/memory/ref_counted.h"
+#include "nativeui/gfx/color.h"
+#include "nativeui/util/yoga_util.h"
+
+namespace nu {
+
+class View;
+
+// A set of styles that is parsed once and can be applied to many views.
+class NATIVEUI_EXPORT StyleSheet : public base::RefCounted<StyleSheet> {
+ public:
+  StyleSheet();
+
+  // Parse and add a style, invalid styles are ignored.
+  void SetStyleProperty(const std::string& name, const std::string& value);
+  void SetStyleProperty(const std::string& name, float value);
+
+  // Set styles in a row.
+  template<typename... Args>
+  void SetStyle(const std::string& name, const std::string& value,
+                Args... args) {
+    SetStyleProperty(name, value);
+    SetStyle(args...);
+  }
+  template<typename... Args>
+  void SetStyle(const std::string& name, float value, Args... args) {
+    SetStyleProperty(name, value);
+    SetStyle(args...);
+  }
+  void SetStyle() {
+  }
+
+  // Apply styles to views, the layout is only done once for each view tree.
+  void ApplyTo(View* view) const;
+  void ApplyToViews(const std::vector<View*>& views) const;
+
+  // Return the number of parsed properties.
+  size_t GetPropertyCount() const;
+
+ private:
+  friend class base::RefCounted<StyleSheet>;
+
+  ~StyleSheet();
+
+  // Set styles without doing layout.
+  void ApplyStyles(View* view) const;
+
+  std::vector<YogaProperty> properties_;
+
+  bool has_color_ = false;
+  Color color_;
+  bool has_background_color_ = false;
+  Color background_color_;
+
+  DISALLOW_COPY_AND_ASSIGN(StyleSheet);
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_STYLE_SHEET_H_
@@ -0,0 +1,53 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/nativeui.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class StyleSheetTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    container_ = new nu::Container;
+    container_->SetBounds(nu::RectF(0, 0, 400, 400));
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  scoped_refptr<nu::Container> container_;
+};
+
+TEST_F(StyleSheetTest, ParseProperties) {
+  scoped_refptr<nu::StyleSheet> sheet = new nu::StyleSheet;
+  sheet->SetStyle("width", 100,
+                  "height", "50%",
+                  "margin-left", "10px",
+                  "flex-direction", "row",
+                  "color", "#FFF");
+  EXPECT_EQ(sheet->GetPropertyCount(), 5u);
+  sheet->SetStyle("unknown", 1, "flex-direction", "invalid");
+  EXPECT_EQ(sheet->GetPropertyCount(), 5u);
+}
+
+TEST_F(StyleSheetTest, ApplyTo) {
+  scoped_refptr<nu::StyleSheet> sheet = new nu::StyleSheet;
+  sheet->SetStyle("width", 100, "height", "50%");
+  scoped_refptr<nu::Container> view = new nu::Container;
+  container_->AddChildView(view.get());
+  sheet->ApplyTo(view.get());
+  EXPECT_EQ(view->GetBounds(), nu::RectF(0, 0, 100, 200));
+}
+
+TEST_F(StyleSheetTest, ApplyToViews) {
+  scoped_refptr<nu::StyleSheet> sheet = new nu::StyleSheet;
+  sheet->SetStyle("height", 40, "margin-top", 10);
+  std::vector<nu::View*> views;
+  for (int i = 0; i < 5; ++i) {
+    nu::Container* view = new nu::Container;
+    container_->AddChildView(view);
+    views.push_back(view);
+  }
+  sheet->ApplyToViews(views);
+  for (int i = 0; i < 5; ++i)
+    EXPECT_EQ(views[i]->GetBounds(), nu::RectF(0, 10 + i * 50, 400, 40));
+}
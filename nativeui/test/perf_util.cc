@@ -0,0 +1,82 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/test/perf_util.h"
+
+#include <stdio.h>
+
+#include "base/strings/string_number_conversions.h"
+#include "nativeui/button.h"
+#include "nativeui/label.h"
+
+namespace nu {
+
+namespace {
+
+// Depth of chains in the deep tree, yoga does layout recursively so very deep
+// trees would overflow the stack.
+const int kChainDepth = 100;
+
+}  // namespace
+
+const int kPerfTreeSizes[3] = { 1000, 10000, 100000 };
+
+const int kPerfMutations = 100;
+
+PerfTimer::PerfTimer() : start_(base::TimeTicks::Now()) {}
+
+base::TimeDelta PerfTimer::Elapsed() const {
+  return base::TimeTicks::Now() - start_;
+}
+
+void PrintPerfResult(const std::string& name,
+                     int views,
+                     base::TimeDelta time) {
+  PrintPerfResult(name, "views", views, time);
+}
+
+void PrintPerfResult(const std::string& name,
+                     const std::string& key,
+                     int count,
+                     base::TimeDelta time) {
+  fprintf(stdout, "PERF {\"name\": \"%s\", \"%s\": %d, \"ms\": %.3f}\n",
+          name.c_str(), key.c_str(), count, time.InMillisecondsF());
+  fflush(stdout);
+}
+
+void BuildWideTree(Container* root, int views) {
+  root->BeginUpdate();
+  for (int i = 0; i < views; ++i)
+    root->AddChildView(new Label(base::NumberToString(i)));
+  root->EndUpdate();
+}
+
+void BuildDeepTree(Container* root, int views) {
+  root->BeginUpdate();
+  for (int i = 0; i < views; i += kChainDepth) {
+    Container* parent = root;
+    for (int j = 1; j < kChainDepth; ++j) {
+      Container* child = new Container;
+      parent->AddChildView(child);
+      parent = child;
+    }
+    parent->AddChildView(new Label(base::NumberToString(i)));
+  }
+  root->EndUpdate();
+}
+
+void BuildMixedTree(Container* root, int views) {
+  root->BeginUpdate();
+  for (int i = 0; i < views; i += 4) {
+    Container* row = new Container;
+    row->SetStyle("flex-direction", "row");
+    row->AddChildView(new Label(base::NumberToString(i)));
+    row->AddChildView(new Button("Button"));
+    row->AddChildView(new Container);
+    root->AddChildView(row);
+  }
+  root->EndUpdate();
+}
+
+}  // namespace nu
@@ -0,0 +1,55 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_TEST_PERF_UTIL_H_
+#define NATIVEUI_TEST_PERF_UTIL_H_
+
+#include <string>
+
+#include "base/time/time.h"
+#include "nativeui/container.h"
+
+namespace nu {
+
+// Numbers of views used by perf tests.
+extern const int kPerfTreeSizes[3];
+
+// Number of mutations timed on a built tree, each mutation relayouts the whole
+// tree so it must be bounded.
+extern const int kPerfMutations;
+
+// Measure the time elapsed since construction.
+class PerfTimer {
+ public:
+  PerfTimer();
+
+  base::TimeDelta Elapsed() const;
+
+ private:
+  base::TimeTicks start_;
+};
+
+// Print the result as one JSON object per line, prefixed with "PERF ".
+void PrintPerfResult(const std::string& name,
+                     int views,
+                     base::TimeDelta time);
+
+// Same with above, but reports |count| under |key| instead of "views".
+void PrintPerfResult(const std::string& name,
+                     const std::string& key,
+                     int count,
+                     base::TimeDelta time);
+
+// Build synthetic trees with about |views| views under |root|, in one batch
+// update so the tree is only laid out once.
+//   Wide:  all views are labels under |root|;
+//   Deep:  chains of nested containers with a label at each end;
+//   Mixed: rows of containers with a label, a button and a container.
+void BuildWideTree(Container* root, int views);
+void BuildDeepTree(Container* root, int views);
+void BuildMixedTree(Container* root, int views);
+
+}  // namespace nu
+
+#endif  // NATIVEUI_TEST_PERF_UTIL_H_
@@ -33,12 +33,14 @@ typedef struct _GtkWindow GtkWindow;
 typedef struct _PangoFontDescription PangoFontDescription;
 typedef struct _PangoLayout PangoLayout;
 typedef struct _cairo_surface cairo_surface_t;
+typedef struct cairo_path cairo_path_t;
 typedef struct _cairo cairo_t;
 typedef union _GdkEvent GdkEvent;
 #endif
 
 #if defined(OS_MACOSX)
 typedef struct CGContext* CGContextRef;
+typedef const struct CGPath* CGPathRef;
 #ifdef __OBJC__
 @class NSMutableAttributedString;
 @class NSAlert;
@@ -82,6 +84,7 @@ class NSWindow;
 namespace Gdiplus {
 class Font;
 class Graphics;
+class GraphicsPath;
 class Image;
 }
 #endif
@@ -113,6 +116,7 @@ using NativeWindow = NSWindow*;
 using NativeBitmap = CGContextRef;
 using NativeDisplay = NSScreen*;
 using NativeImage = NSImage*;
+using NativePath = CGPathRef;
 using nativeGraphicsContext = NSGraphicsContext*;
 using NativeFont = NSFont*;
 using NativeMenu = NSMenu*;
@@ -131,6 +135,7 @@ using NativeView = GtkWidget*;
 using NativeWindow = GtkWindow*;
 using NativeBitmap = cairo_surface_t*;
 using NativeImage = GdkPixbufAnimation*;
+using NativePath = cairo_path_t*;
 using nativeGraphicsContext = cairo_t*;
 using NativeFont = PangoFontDescription*;
 using NativeMenu = GtkMenuShell*;
@@ -150,6 +155,7 @@ using NativeBitmap = DoubleBuffer*;
 using NativeFont = Gdiplus::Font*;
 using nativeGraphicsContext = Gdiplus::Graphics*;
 using NativeImage = Gdiplus::Image*;
+using NativePath = Gdiplus::GraphicsPath*;
 using NativeMenu = HMENU;
 using NativeMenuItem = MenuItemData*;
 using NativeTray = TrayImpl*;
@@ -0,0 +1,135 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/util/layout_snapshot.h"
+
+#include <utility>
+
+#include "nativeui/container.h"
+#include "nativeui/util/yoga_util.h"
+#include "third_party/yoga/YGNode.h"
+#include "third_party/yoga/Yoga.h"
+
+namespace nu {
+
+struct LayoutSnapshot::Leaf {
+  struct Measurement {
+    float width;
+    float height;
+    SizeF size;
+  };
+
+  Leaf(View* view, YGNodeRef node, int* missing_count)
+      : view(view), node(node), missing_count(missing_count) {}
+
+  View* view;
+  YGNodeRef node;
+  int* missing_count;
+  std::vector<Measurement> results;
+  std::vector<std::pair<float, float>> missing;
+};
+
+namespace {
+
+// Look up the size measured on the UI thread.
+YGSize MeasureLeaf(YGNodeRef node,
+                   float width, YGMeasureMode mode,
+                   float height, YGMeasureMode height_mode) {
+  auto* leaf = static_cast<LayoutSnapshot::Leaf*>(YGNodeGetContext(node));
+  for (const auto& result : leaf->results) {
+    if (ConstraintEquals(result.width, width) &&
+        ConstraintEquals(result.height, height))
+      return {result.size.width(), result.size.height()};
+  }
+  // Record the miss, the node will be computed again after the UI thread has
+  // measured it.
+  for (const auto& missing : leaf->missing) {
+    if (ConstraintEquals(missing.first, width) &&
+        ConstraintEquals(missing.second, height))
+      return {0, 0};
+  }
+  leaf->missing.emplace_back(width, height);
+  ++(*leaf->missing_count);
+  return {0, 0};
+}
+
+// Copy the computed layout of the cloned node back to the original node, so
+// readers of the CSS nodes get the results.
+void CopyLayout(YGNodeRef from, YGNodeRef to) {
+  to->setLayout(from->getLayout());
+}
+
+}  // namespace
+
+LayoutSnapshot::LayoutSnapshot(Container* root, int generation)
+    : root_(root),
+      generation_(generation),
+      size_(root->GetBounds().size()) {
+  node_ = CloneTree(root);
+}
+
+LayoutSnapshot::~LayoutSnapshot() {
+  YGNodeFreeRecursive(node_);
+}
+
+bool LayoutSnapshot::Compute() {
+  ++passes_;
+  missing_count_ = 0;
+  CalculateYogaLayout(node_, size_.width(), size_.height());
+  return missing_count_ == 0;
+}
+
+void LayoutSnapshot::MeasureMissing() {
+  for (const auto& leaf : leaves_) {
+    if (leaf->missing.empty())
+      continue;
+    for (const auto& missing : leaf->missing) {
+      SizeF size = leaf->view->MeasureContent(missing.first, missing.second);
+      leaf->results.push_back({missing.first, missing.second, size});
+    }
+    leaf->missing.clear();
+    // Drop the placeholder results cached by yoga.
+    YGNodeMarkDirty(leaf->node);
+  }
+}
+
+void LayoutSnapshot::Apply() {
+  CopyLayout(node_, root_->node());
+  ApplyToContainer(root_.get(), node_);
+}
+
+YGNodeRef LayoutSnapshot::CloneTree(View* view) {
+  views_.push_back(view);
+  YGNodeRef clone = YGNodeClone(view->node());
+  YGNodeSetDirtiedFunc(clone, nullptr);
+  if (YGNodeHasMeasureFunc(clone)) {
+    leaves_.push_back(std::make_unique<Leaf>(view, clone, &missing_count_));
+    YGNodeSetContext(clone, leaves_.back().get());
+    YGNodeSetMeasureFunc(clone, &MeasureLeaf);
+    return clone;
+  }
+  YGNodeSetContext(clone, nullptr);
+  if (!view->IsContainer())
+    return clone;
+  // The clone shares children with original node, replace them with copies.
+  Container* container = static_cast<Container*>(view);
+  YGNodeRemoveAllChildren(clone);
+  for (int i = 0; i < container->ChildCount(); ++i)
+    YGNodeInsertChild(clone, CloneTree(container->ChildAt(i)), i);
+  return clone;
+}
+
+void LayoutSnapshot::ApplyToContainer(Container* container, YGNodeRef node) {
+  for (int i = 0; i < container->ChildCount(); ++i)
+    CopyLayout(YGNodeGetChild(node, i), container->ChildAt(i)->node());
+  // Parents must be placed before their children.
+  container->ApplyAsyncLayout();
+  for (int i = 0; i < container->ChildCount(); ++i) {
+    View* child = container->ChildAt(i);
+    if (child->IsContainer())
+      ApplyToContainer(static_cast<Container*>(child), YGNodeGetChild(node, i));
+  }
+}
+
+}  // namespace nu
@@ -0,0 +1,81 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_UTIL_LAYOUT_SNAPSHOT_H_
+#define NATIVEUI_UTIL_LAYOUT_SNAPSHOT_H_
+
+#include <memory>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "nativeui/gfx/geometry/size_f.h"
+
+typedef struct YGNode *YGNodeRef;
+
+namespace nu {
+
+class Container;
+class View;
+
+// A copy of the CSS nodes under a root container, which can be laid out on a
+// background thread.
+//
+// The snapshot is created, measured and applied on the UI thread, while the
+// background thread only touches the copied nodes, and calculates the layout
+// with CalculateYogaLayout which serializes it with layouts of other trees.
+// Measure functions of the copied nodes are replaced with lookups of the
+// results measured on the UI thread, and misses are recorded so they can be
+// measured before computing again.
+//
+// The snapshot keeps references to the views, so the last reference must be
+// released on the UI thread.
+class LayoutSnapshot : public base::RefCountedThreadSafe<LayoutSnapshot> {
+ public:
+  // A view whose CSS node has measure function.
+  struct Leaf;
+
+  LayoutSnapshot(Container* root, int generation);
+
+  // Background thread: Compute the layout, return false if there are missing
+  // measurements.
+  bool Compute();
+
+  // UI thread: Measure the missing ones and mark their nodes dirty.
+  void MeasureMissing();
+
+  // UI thread: Copy the computed layout to the CSS nodes of views and set
+  // their bounds.
+  void Apply();
+
+  Container* root() const { return root_.get(); }
+  int generation() const { return generation_; }
+  int passes() const { return passes_; }
+
+ private:
+  friend class base::RefCountedThreadSafe<LayoutSnapshot>;
+
+  ~LayoutSnapshot();
+
+  YGNodeRef CloneTree(View* view);
+  void ApplyToContainer(Container* container, YGNodeRef node);
+
+  scoped_refptr<Container> root_;
+  int generation_;
+  SizeF size_;
+  int passes_ = 0;
+
+  // The copied tree.
+  YGNodeRef node_;
+
+  // Keep the views alive until the snapshot is done.
+  std::vector<scoped_refptr<View>> views_;
+  std::vector<std::unique_ptr<Leaf>> leaves_;
+  int missing_count_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(LayoutSnapshot);
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_UTIL_LAYOUT_SNAPSHOT_H_
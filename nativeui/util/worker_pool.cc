@@ -0,0 +1,45 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include "nativeui/util/worker_pool.h"
+
+#include <utility>
+
+namespace nu {
+
+namespace {
+
+// Number of background threads.
+const int kWorkerThreadCount = 4;
+
+// Run a task and delete itself.
+class TaskDelegate : public base::DelegateSimpleThread::Delegate {
+ public:
+  explicit TaskDelegate(WorkerPool::Task task) : task_(std::move(task)) {}
+
+  void Run() override {
+    task_();
+    delete this;
+  }
+
+ private:
+  WorkerPool::Task task_;
+};
+
+}  // namespace
+
+WorkerPool::WorkerPool() : pool_("nu_worker", kWorkerThreadCount) {
+  pool_.Start();
+}
+
+WorkerPool::~WorkerPool() {
+  // Pending tasks are run before the threads quit.
+  pool_.JoinAll();
+}
+
+void WorkerPool::PostTask(Task task) {
+  pool_.AddWork(new TaskDelegate(std::move(task)));
+}
+
+}  // namespace nu
@@ -0,0 +1,34 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#ifndef NATIVEUI_UTIL_WORKER_POOL_H_
+#define NATIVEUI_UTIL_WORKER_POOL_H_
+
+#include <functional>
+
+#include "base/threading/simple_thread.h"
+
+namespace nu {
+
+// Run tasks on a fixed number of background threads, the tasks must not touch
+// views or other objects that live on the UI thread.
+class WorkerPool {
+ public:
+  using Task = std::function<void()>;
+
+  WorkerPool();
+  ~WorkerPool();
+
+  // Run the |task| on one of the background threads, thread-safe.
+  void PostTask(Task task);
+
+ private:
+  base::DelegateSimpleThreadPool pool_;
+
+  DISALLOW_COPY_AND_ASSIGN(WorkerPool);
+};
+
+}  // namespace nu
+
+#endif  // NATIVEUI_UTIL_WORKER_POOL_H_
@@ -4,13 +4,17 @@
 
 #include "nativeui/util/yoga_util.h"
 
+#include <stdint.h>
+
 #include <algorithm>
 #include <tuple>
 #include <utility>
 
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
+#include "base/synchronization/lock.h"
 #include "third_party/yoga/Yoga.h"
 
 namespace nu {
@@ -150,104 +154,247 @@ int PercentValue(const std::string& value) {
   return integer;
 }
 
+// Identifiers of style properties, must be sorted by name.
+enum class YogaKey {
+  AlignContent,
+  AlignItems,
+  AlignSelf,
+  AspectRatio,
+  Border,
+  BorderBottom,
+  BorderLeft,
+  BorderRight,
+  BorderTop,
+  Bottom,
+  Direction,
+  Display,
+  Flex,
+  FlexBasis,
+  FlexDirection,
+  FlexGrow,
+  FlexShrink,
+  FlexWrap,
+  Height,
+  JustifyContent,
+  Left,
+  Margin,
+  MarginBottom,
+  MarginLeft,
+  MarginRight,
+  MarginTop,
+  MaxHeight,
+  MaxWidth,
+  MinHeight,
+  MinWidth,
+  Overflow,
+  Padding,
+  PaddingBottom,
+  PaddingLeft,
+  PaddingRight,
+  PaddingTop,
+  Position,
+  Right,
+  Top,
+  Width,
+  Invalid,
+};
+
+// FNV-1a hash that can be computed at compile time.
+constexpr uint32_t HashName(const char* str, uint32_t hash = 2166136261u) {
+  return *str ? HashName(str + 1,
+                         (hash ^ static_cast<uint8_t>(*str)) * 16777619u)
+              : hash;
+}
+
+// Map the name to key with a perfect hash, the compiler refuses duplicate
+// case labels so a collision would fail the build.
+YogaKey LookupKey(const std::string& name) {
+#define YOGA_KEY(str, key) \
+    case HashName(str): return name == str ? YogaKey::key : YogaKey::Invalid;
+  switch (HashName(name.c_str())) {
+    YOGA_KEY("aligncontent", AlignContent)
+    YOGA_KEY("alignitems", AlignItems)
+    YOGA_KEY("alignself", AlignSelf)
+    YOGA_KEY("aspectratio", AspectRatio)
+    YOGA_KEY("border", Border)
+    YOGA_KEY("borderbottom", BorderBottom)
+    YOGA_KEY("borderleft", BorderLeft)
+    YOGA_KEY("borderright", BorderRight)
+    YOGA_KEY("bordertop", BorderTop)
+    YOGA_KEY("bottom", Bottom)
+    YOGA_KEY("direction", Direction)
+    YOGA_KEY("display", Display)
+    YOGA_KEY("flex", Flex)
+    YOGA_KEY("flexbasis", FlexBasis)
+    YOGA_KEY("flexdirection", FlexDirection)
+    YOGA_KEY("flexgrow", FlexGrow)
+    YOGA_KEY("flexshrink", FlexShrink)
+    YOGA_KEY("flexwrap", FlexWrap)
+    YOGA_KEY("height", Height)
+    YOGA_KEY("justifycontent", JustifyContent)
+    YOGA_KEY("left", Left)
+    YOGA_KEY("margin", Margin)
+    YOGA_KEY("marginbottom", MarginBottom)
+    YOGA_KEY("marginleft", MarginLeft)
+    YOGA_KEY("marginright", MarginRight)
+    YOGA_KEY("margintop", MarginTop)
+    YOGA_KEY("maxheight", MaxHeight)
+    YOGA_KEY("maxwidth", MaxWidth)
+    YOGA_KEY("minheight", MinHeight)
+    YOGA_KEY("minwidth", MinWidth)
+    YOGA_KEY("overflow", Overflow)
+    YOGA_KEY("padding", Padding)
+    YOGA_KEY("paddingbottom", PaddingBottom)
+    YOGA_KEY("paddingleft", PaddingLeft)
+    YOGA_KEY("paddingright", PaddingRight)
+    YOGA_KEY("paddingtop", PaddingTop)
+    YOGA_KEY("position", Position)
+    YOGA_KEY("right", Right)
+    YOGA_KEY("top", Top)
+    YOGA_KEY("width", Width)
+    default: return YogaKey::Invalid;
+  }
+#undef YOGA_KEY
+}
+
 // We use int to represent enums.
-using IntSetter = void(*)(const YGNodeRef, int);
-using FloatSetter = void(*)(const YGNodeRef, float);
-using AutoSetter = void(*)(const YGNodeRef);
-using EdgeSetter = void(*)(const YGNodeRef, const YGEdge, float);
+using IntSetter = YogaProperty::IntSetter;
+using FloatSetter = YogaProperty::FloatSetter;
+using AutoSetter = YogaProperty::AutoSetter;
+using EdgeSetter = YogaProperty::EdgeSetter;
 
 // Sorted list of CSS node properties.
-const std::tuple<const char*, IntConverter, IntSetter> int_setters[] = {
-  { "aligncontent", AlignValue,
+const std::tuple<YogaKey, IntConverter, IntSetter> int_setters[] = {
+  { YogaKey::AlignContent, AlignValue,
     reinterpret_cast<IntSetter>(YGNodeStyleSetAlignContent) },
-  { "alignitems", AlignValue,
+  { YogaKey::AlignItems, AlignValue,
     reinterpret_cast<IntSetter>(YGNodeStyleSetAlignItems) },
-  { "alignself", AlignValue,
+  { YogaKey::AlignSelf, AlignValue,
     reinterpret_cast<IntSetter>(YGNodeStyleSetAlignSelf) },
-  { "direction", DirectionValue,
+  { YogaKey::Direction, DirectionValue,
     reinterpret_cast<IntSetter>(YGNodeStyleSetDirection) },
-  { "display", DisplayValue,
+  { YogaKey::Display, DisplayValue,
     reinterpret_cast<IntSetter>(YGNodeStyleSetDisplay) },
-  { "flexdirection", FlexDirectionValue,
+  { YogaKey::FlexDirection, FlexDirectionValue,
     reinterpret_cast<IntSetter>(YGNodeStyleSetFlexDirection) },
-  { "flexwrap", WrapValue,
+  { YogaKey::FlexWrap, WrapValue,
     reinterpret_cast<IntSetter>(YGNodeStyleSetFlexWrap) },
-  { "justifycontent", JustifyValue,
+  { YogaKey::JustifyContent, JustifyValue,
     reinterpret_cast<IntSetter>(YGNodeStyleSetJustifyContent) },
-  { "overflow", OverflowValue,
+  { YogaKey::Overflow, OverflowValue,
     reinterpret_cast<IntSetter>(YGNodeStyleSetOverflow) },
-  { "position", PositionValue,
+  { YogaKey::Position, PositionValue,
     reinterpret_cast<IntSetter>(YGNodeStyleSetPositionType) },
 };
-const std::pair<const char*, FloatSetter> float_setters[] = {
-  { "aspectratio", YGNodeStyleSetAspectRatio },
-  { "flex", YGNodeStyleSetFlex },
-  { "flexbasis", YGNodeStyleSetFlexBasis },
-  { "flexgrow", YGNodeStyleSetFlexGrow },
-  { "flexshrink", YGNodeStyleSetFlexShrink },
-  { "height", YGNodeStyleSetHeight },
-  { "maxheight", YGNodeStyleSetMaxHeight },
-  { "maxwidth", YGNodeStyleSetMaxWidth },
-  { "minheight", YGNodeStyleSetMinHeight },
-  { "minwidth", YGNodeStyleSetMinWidth },
-  { "width", YGNodeStyleSetWidth },
+const std::pair<YogaKey, FloatSetter> float_setters[] = {
+  { YogaKey::AspectRatio, YGNodeStyleSetAspectRatio },
+  { YogaKey::Flex, YGNodeStyleSetFlex },
+  { YogaKey::FlexBasis, YGNodeStyleSetFlexBasis },
+  { YogaKey::FlexGrow, YGNodeStyleSetFlexGrow },
+  { YogaKey::FlexShrink, YGNodeStyleSetFlexShrink },
+  { YogaKey::Height, YGNodeStyleSetHeight },
+  { YogaKey::MaxHeight, YGNodeStyleSetMaxHeight },
+  { YogaKey::MaxWidth, YGNodeStyleSetMaxWidth },
+  { YogaKey::MinHeight, YGNodeStyleSetMinHeight },
+  { YogaKey::MinWidth, YGNodeStyleSetMinWidth },
+  { YogaKey::Width, YGNodeStyleSetWidth },
 };
-const std::pair<const char*, AutoSetter> auto_setters[] = {
-  { "flexbasis", YGNodeStyleSetFlexBasisAuto},
-  { "height", YGNodeStyleSetHeightAuto},
-  { "width", YGNodeStyleSetWidthAuto},
+const std::pair<YogaKey, AutoSetter> auto_setters[] = {
+  { YogaKey::FlexBasis, YGNodeStyleSetFlexBasisAuto},
+  { YogaKey::Height, YGNodeStyleSetHeightAuto},
+  { YogaKey::Width, YGNodeStyleSetWidthAuto},
 };
-const std::pair<const char*, FloatSetter> percent_setters[] = {
-  { "flexbasis", YGNodeStyleSetFlexBasisPercent },
-  { "height", YGNodeStyleSetHeightPercent },
-  { "maxheight", YGNodeStyleSetMaxHeightPercent },
-  { "maxwidth", YGNodeStyleSetMaxWidthPercent },
-  { "minheight", YGNodeStyleSetMinHeightPercent },
-  { "minwidth", YGNodeStyleSetMinWidthPercent },
-  { "width", YGNodeStyleSetWidthPercent },
+const std::pair<YogaKey, FloatSetter> percent_setters[] = {
+  { YogaKey::FlexBasis, YGNodeStyleSetFlexBasisPercent },
+  { YogaKey::Height, YGNodeStyleSetHeightPercent },
+  { YogaKey::MaxHeight, YGNodeStyleSetMaxHeightPercent },
+  { YogaKey::MaxWidth, YGNodeStyleSetMaxWidthPercent },
+  { YogaKey::MinHeight, YGNodeStyleSetMinHeightPercent },
+  { YogaKey::MinWidth, YGNodeStyleSetMinWidthPercent },
+  { YogaKey::Width, YGNodeStyleSetWidthPercent },
 };
-const std::tuple<const char*, YGEdge, EdgeSetter> edge_setters[] = {
-  { "border", YGEdgeAll, YGNodeStyleSetBorder },
-  { "borderbottom", YGEdgeBottom, YGNodeStyleSetBorder },
-  { "borderleft", YGEdgeLeft, YGNodeStyleSetBorder },
-  { "borderright", YGEdgeRight, YGNodeStyleSetBorder },
-  { "bordertop", YGEdgeTop, YGNodeStyleSetBorder },
-  { "bottom", YGEdgeBottom, YGNodeStyleSetPosition },
-  { "left", YGEdgeLeft, YGNodeStyleSetPosition },
-  { "margin", YGEdgeAll, YGNodeStyleSetMargin },
-  { "marginbottom", YGEdgeBottom, YGNodeStyleSetMargin },
-  { "marginleft", YGEdgeLeft, YGNodeStyleSetMargin },
-  { "marginright", YGEdgeRight, YGNodeStyleSetMargin },
-  { "margintop", YGEdgeTop, YGNodeStyleSetMargin },
-  { "padding", YGEdgeAll, YGNodeStyleSetPadding },
-  { "paddingbottom", YGEdgeBottom, YGNodeStyleSetPadding },
-  { "paddingleft", YGEdgeLeft, YGNodeStyleSetPadding },
-  { "paddingright", YGEdgeRight, YGNodeStyleSetPadding },
-  { "paddingtop", YGEdgeTop, YGNodeStyleSetPadding },
-  { "right", YGEdgeRight, YGNodeStyleSetPosition },
-  { "top", YGEdgeTop, YGNodeStyleSetPosition },
+// Edges are passed as int in YogaProperty, adapt the setters instead of
+// casting them to a different function type.
+template<void(*setter)(YGNodeRef, YGEdge, float)>
+void SetEdge(YGNodeRef node, int edge, float value) {
+  setter(node, static_cast<YGEdge>(edge), value);
+}
+
+const std::tuple<YogaKey, YGEdge, EdgeSetter> edge_setters[] = {
+  { YogaKey::Border, YGEdgeAll,
+    SetEdge<YGNodeStyleSetBorder> },
+  { YogaKey::BorderBottom, YGEdgeBottom,
+    SetEdge<YGNodeStyleSetBorder> },
+  { YogaKey::BorderLeft, YGEdgeLeft,
+    SetEdge<YGNodeStyleSetBorder> },
+  { YogaKey::BorderRight, YGEdgeRight,
+    SetEdge<YGNodeStyleSetBorder> },
+  { YogaKey::BorderTop, YGEdgeTop,
+    SetEdge<YGNodeStyleSetBorder> },
+  { YogaKey::Bottom, YGEdgeBottom,
+    SetEdge<YGNodeStyleSetPosition> },
+  { YogaKey::Left, YGEdgeLeft,
+    SetEdge<YGNodeStyleSetPosition> },
+  { YogaKey::Margin, YGEdgeAll,
+    SetEdge<YGNodeStyleSetMargin> },
+  { YogaKey::MarginBottom, YGEdgeBottom,
+    SetEdge<YGNodeStyleSetMargin> },
+  { YogaKey::MarginLeft, YGEdgeLeft,
+    SetEdge<YGNodeStyleSetMargin> },
+  { YogaKey::MarginRight, YGEdgeRight,
+    SetEdge<YGNodeStyleSetMargin> },
+  { YogaKey::MarginTop, YGEdgeTop,
+    SetEdge<YGNodeStyleSetMargin> },
+  { YogaKey::Padding, YGEdgeAll,
+    SetEdge<YGNodeStyleSetPadding> },
+  { YogaKey::PaddingBottom, YGEdgeBottom,
+    SetEdge<YGNodeStyleSetPadding> },
+  { YogaKey::PaddingLeft, YGEdgeLeft,
+    SetEdge<YGNodeStyleSetPadding> },
+  { YogaKey::PaddingRight, YGEdgeRight,
+    SetEdge<YGNodeStyleSetPadding> },
+  { YogaKey::PaddingTop, YGEdgeTop,
+    SetEdge<YGNodeStyleSetPadding> },
+  { YogaKey::Right, YGEdgeRight,
+    SetEdge<YGNodeStyleSetPosition> },
+  { YogaKey::Top, YGEdgeTop,
+    SetEdge<YGNodeStyleSetPosition> },
 };
-const std::tuple<const char*, YGEdge, EdgeSetter> edge_percent_setters[] = {
-  { "bottom", YGEdgeBottom, YGNodeStyleSetPositionPercent },
-  { "left", YGEdgeLeft, YGNodeStyleSetPositionPercent },
-  { "margin", YGEdgeAll, YGNodeStyleSetMarginPercent },
-  { "marginbottom", YGEdgeBottom, YGNodeStyleSetMarginPercent },
-  { "marginleft", YGEdgeLeft, YGNodeStyleSetMarginPercent },
-  { "marginright", YGEdgeRight, YGNodeStyleSetMarginPercent },
-  { "margintop", YGEdgeTop, YGNodeStyleSetMarginPercent },
-  { "padding", YGEdgeAll, YGNodeStyleSetPaddingPercent },
-  { "paddingbottom", YGEdgeBottom, YGNodeStyleSetPaddingPercent },
-  { "paddingleft", YGEdgeLeft, YGNodeStyleSetPaddingPercent },
-  { "paddingright", YGEdgeRight, YGNodeStyleSetPaddingPercent },
-  { "paddingtop", YGEdgeTop, YGNodeStyleSetPaddingPercent },
-  { "right", YGEdgeRight, YGNodeStyleSetPositionPercent },
-  { "top", YGEdgeTop, YGNodeStyleSetPositionPercent },
+const std::tuple<YogaKey, YGEdge, EdgeSetter> edge_percent_setters[] = {
+  { YogaKey::Bottom, YGEdgeBottom,
+    SetEdge<YGNodeStyleSetPositionPercent> },
+  { YogaKey::Left, YGEdgeLeft,
+    SetEdge<YGNodeStyleSetPositionPercent> },
+  { YogaKey::Margin, YGEdgeAll,
+    SetEdge<YGNodeStyleSetMarginPercent> },
+  { YogaKey::MarginBottom, YGEdgeBottom,
+    SetEdge<YGNodeStyleSetMarginPercent> },
+  { YogaKey::MarginLeft, YGEdgeLeft,
+    SetEdge<YGNodeStyleSetMarginPercent> },
+  { YogaKey::MarginRight, YGEdgeRight,
+    SetEdge<YGNodeStyleSetMarginPercent> },
+  { YogaKey::MarginTop, YGEdgeTop,
+    SetEdge<YGNodeStyleSetMarginPercent> },
+  { YogaKey::Padding, YGEdgeAll,
+    SetEdge<YGNodeStyleSetPaddingPercent> },
+  { YogaKey::PaddingBottom, YGEdgeBottom,
+    SetEdge<YGNodeStyleSetPaddingPercent> },
+  { YogaKey::PaddingLeft, YGEdgeLeft,
+    SetEdge<YGNodeStyleSetPaddingPercent> },
+  { YogaKey::PaddingRight, YGEdgeRight,
+    SetEdge<YGNodeStyleSetPaddingPercent> },
+  { YogaKey::PaddingTop, YGEdgeTop,
+    SetEdge<YGNodeStyleSetPaddingPercent> },
+  { YogaKey::Right, YGEdgeRight,
+    SetEdge<YGNodeStyleSetPositionPercent> },
+  { YogaKey::Top, YGEdgeTop,
+    SetEdge<YGNodeStyleSetPositionPercent> },
 };
 
 // Compare function to compare elements.
 template<typename T>
 bool ElementCompare(const T& e1, const T& e2) {
-  return base::StringPiece(std::get<0>(e1)) < std::get<0>(e2);
+  return std::get<0>(e1) < std::get<0>(e2);
 }
 
 // Check if the array is sorted.
@@ -259,25 +406,26 @@ bool IsSorted(T (&setters)[n]) {
 
 // Compare function to compare between elements and keys.
 template<typename T>
-bool FirstCompare(const T& element, const std::string& key) {
+bool FirstCompare(const T& element, YogaKey key) {
   return std::get<0>(element) < key;
 }
 
 // Find out the setter from array.
 template<typename T, size_t n>
-T* Find(T (&setters)[n], const std::string& name) {
-  auto iter = std::lower_bound(std::begin(setters), std::end(setters), name,
+T* Find(T (&setters)[n], YogaKey key) {
+  auto iter = std::lower_bound(std::begin(setters), std::end(setters), key,
                                FirstCompare<T>);
-  if (iter == std::end(setters) || name != std::get<0>(*iter))
+  if (iter == std::end(setters) || key != std::get<0>(*iter))
     return nullptr;
   return &(*iter);
 }
 
-// Set style for int properties.
-bool SetIntStyle(YGNodeRef node,
-                 const std::string& name,
-                 const std::string& value) {
-  auto* tup = Find(int_setters, name);
+// Parse int properties.
+bool ParseIntStyle(YogaKey key,
+                   const std::string& name,
+                   const std::string& value,
+                   YogaProperty* out) {
+  auto* tup = Find(int_setters, key);
   if (!tup)
     return false;
   int converted;
@@ -285,72 +433,81 @@ bool SetIntStyle(YGNodeRef node,
     LOG(WARNING) << "Invalid value " << value << " for property " << name;
     return false;
   }
-  std::get<2>(*tup)(node, converted);
+  out->type = YogaProperty::Type::Int;
+  out->int_setter = std::get<2>(*tup);
+  out->int_value = converted;
   return true;
 }
 
-// Set style for float properties.
-bool SetFloatStyle(YGNodeRef node, const std::string& name, float value) {
-  auto* tup = Find(float_setters, name);
+// Parse float properties.
+bool ParseFloatStyle(YogaKey key, float value, YogaProperty* out) {
+  auto* tup = Find(float_setters, key);
   if (!tup)
     return false;
-  std::get<1>(*tup)(node, value);
+  out->type = YogaProperty::Type::Float;
+  out->float_setter = std::get<1>(*tup);
+  out->float_value = value;
   return true;
 }
 
-// Set "auto" property for styles.
-bool SetAutoStyle(YGNodeRef node, const std::string& name) {
-  auto* tup = Find(auto_setters, name);
+// Parse "auto" property for styles.
+bool ParseAutoStyle(YogaKey key, YogaProperty* out) {
+  auto* tup = Find(auto_setters, key);
   if (!tup)
     return false;
-  std::get<1>(*tup)(node);
+  out->type = YogaProperty::Type::Auto;
+  out->auto_setter = std::get<1>(*tup);
   return true;
 }
 
 // Dispatch to float for auto depending on the value.
-bool SetUnitStyle(YGNodeRef node,
-                  const std::string& name,
-                  const std::string& value) {
+bool ParseUnitStyle(YogaKey key, const std::string& value, YogaProperty* out) {
   if (value == "auto")
-    return SetAutoStyle(node, name);
+    return ParseAutoStyle(key, out);
   else
-    return SetFloatStyle(node, name, PixelValue(value));
+    return ParseFloatStyle(key, PixelValue(value), out);
 }
 
-// Set style for percent properties.
-bool SetPercentStyle(YGNodeRef node,
-                     const std::string& name,
-                     const std::string& value) {
-  auto* tup = Find(percent_setters, name);
+// Parse percent properties.
+bool ParsePercentStyle(YogaKey key,
+                       const std::string& value,
+                       YogaProperty* out) {
+  auto* tup = Find(percent_setters, key);
   if (!tup)
     return false;
-  std::get<1>(*tup)(node, PercentValue(value));
+  out->type = YogaProperty::Type::Float;
+  out->float_setter = std::get<1>(*tup);
+  out->float_value = PercentValue(value);
   return true;
 }
 
-// Set style for edge properties.
-bool SetEdgeStyle(YGNodeRef node, const std::string& name, float value) {
-  auto* tup = Find(edge_setters, name);
+// Parse edge properties.
+bool ParseEdgeStyle(YogaKey key, float value, YogaProperty* out) {
+  auto* tup = Find(edge_setters, key);
   if (!tup)
     return false;
-  std::get<2>(*tup)(node, std::get<1>(*tup), value);
+  out->type = YogaProperty::Type::Edge;
+  out->edge_setter = std::get<2>(*tup);
+  out->edge = static_cast<int>(std::get<1>(*tup));
+  out->float_value = value;
   return true;
 }
 
-bool SetEdgeStyle(YGNodeRef node,
-                  const std::string& name,
-                  const std::string& value) {
-  return SetEdgeStyle(node, name, PixelValue(value));
+bool ParseEdgeStyle(YogaKey key, const std::string& value, YogaProperty* out) {
+  return ParseEdgeStyle(key, PixelValue(value), out);
 }
 
-// Set style for edge percent properties.
-bool SetEdgePercentStyle(YGNodeRef node,
-                         const std::string& name,
-                         const std::string& value) {
-  auto* tup = Find(edge_percent_setters, name);
+// Parse edge percent properties.
+bool ParseEdgePercentStyle(YogaKey key,
+                           const std::string& value,
+                           YogaProperty* out) {
+  auto* tup = Find(edge_percent_setters, key);
   if (!tup)
     return false;
-  std::get<2>(*tup)(node, std::get<1>(*tup), PercentValue(value));
+  out->type = YogaProperty::Type::Edge;
+  out->edge_setter = std::get<2>(*tup);
+  out->edge = static_cast<int>(std::get<1>(*tup));
+  out->float_value = PercentValue(value);
   return true;
 }
 
@@ -363,28 +520,83 @@ bool IsPercentValue(const std::string& value) {
 
 }  // namespace
 
-void SetYogaProperty(YGNodeRef node, const std::string& name, float value) {
-  SetFloatStyle(node, name, value) ||
-  SetEdgeStyle(node, name, value);
+std::string ParseStyleName(const std::string& name) {
+  std::string parsed;
+  parsed.reserve(name.size());
+  for (char c : name) {
+    if (base::IsAsciiAlpha(c))
+      parsed.push_back(base::ToLowerASCII(c));
+  }
+  return parsed;
 }
 
-void SetYogaProperty(YGNodeRef node,
-                     const std::string& name,
-                     const std::string& value) {
+bool ParseYogaProperty(const std::string& name,
+                       float value,
+                       YogaProperty* out) {
+  YogaKey key = LookupKey(name);
+  if (key == YogaKey::Invalid)
+    return false;
+  return ParseFloatStyle(key, value, out) ||
+         ParseEdgeStyle(key, value, out);
+}
+
+bool ParseYogaProperty(const std::string& name,
+                       const std::string& value,
+                       YogaProperty* out) {
   DCHECK(IsSorted(int_setters) &&
          IsSorted(float_setters) &&
          IsSorted(auto_setters) &&
          IsSorted(percent_setters) &&
          IsSorted(edge_setters) &&
          IsSorted(edge_percent_setters)) << "Property setters must be sorted";
+  YogaKey key = LookupKey(name);
+  if (key == YogaKey::Invalid)
+    return false;
   if (IsPercentValue(value)) {
-    SetPercentStyle(node, name, value) ||
-    SetEdgePercentStyle(node, name, value);
+    return ParsePercentStyle(key, value, out) ||
+           ParseEdgePercentStyle(key, value, out);
   } else {
-    SetIntStyle(node, name, value) ||
-    SetUnitStyle(node, name, value) ||
-    SetEdgeStyle(node, name, value);
+    return ParseIntStyle(key, name, value, out) ||
+           ParseUnitStyle(key, value, out) ||
+           ParseEdgeStyle(key, value, out);
   }
 }
 
+void ApplyYogaProperty(YGNodeRef node, const YogaProperty& property) {
+  switch (property.type) {
+    case YogaProperty::Type::Int:
+      property.int_setter(node, property.int_value);
+      break;
+    case YogaProperty::Type::Float:
+      property.float_setter(node, property.float_value);
+      break;
+    case YogaProperty::Type::Auto:
+      property.auto_setter(node);
+      break;
+    case YogaProperty::Type::Edge:
+      property.edge_setter(node, property.edge, property.float_value);
+      break;
+  }
+}
+
+void CalculateYogaLayout(YGNodeRef node, float width, float height) {
+  static base::NoDestructor<base::Lock> lock;
+  base::AutoLock auto_lock(*lock);
+  YGNodeCalculateLayout(node, width, height, YGDirectionLTR);
+}
+
+void SetYogaProperty(YGNodeRef node, const std::string& name, float value) {
+  YogaProperty property;
+  if (ParseYogaProperty(name, value, &property))
+    ApplyYogaProperty(node, property);
+}
+
+void SetYogaProperty(YGNodeRef node,
+                     const std::string& name,
+                     const std::string& value) {
+  YogaProperty property;
+  if (ParseYogaProperty(name, value, &property))
+    ApplyYogaProperty(node, property);
+}
+
 }  // namespace nu
@@ -5,17 +5,72 @@
 #ifndef NATIVEUI_UTIL_YOGA_UTIL_H_
 #define NATIVEUI_UTIL_YOGA_UTIL_H_
 
+#include <cmath>
 #include <string>
 
 typedef struct YGNode *YGNodeRef;
 
 namespace nu {
 
+// A parsed style property that can be applied to nodes without parsing again.
+struct YogaProperty {
+  // We use int to represent enums.
+  using IntSetter = void(*)(YGNodeRef, int);
+  using FloatSetter = void(*)(YGNodeRef, float);
+  using AutoSetter = void(*)(YGNodeRef);
+  using EdgeSetter = void(*)(YGNodeRef, int, float);
+
+  enum class Type {
+    Int,
+    Float,
+    Auto,
+    Edge,
+  };
+
+  Type type = Type::Auto;
+  union {
+    IntSetter int_setter;
+    FloatSetter float_setter;
+    AutoSetter auto_setter;
+    EdgeSetter edge_setter;
+  };
+  union {
+    int int_value;
+    float float_value;
+  };
+  int edge = 0;
+};
+
+// Convert case to lower and remove non-ASCII characters.
+std::string ParseStyleName(const std::string& name);
+
+// Parse the property, |name| must have been normalized by ParseStyleName.
+bool ParseYogaProperty(const std::string& name,
+                       float value,
+                       YogaProperty* out);
+bool ParseYogaProperty(const std::string& name,
+                       const std::string& value,
+                       YogaProperty* out);
+
+// Apply the parsed property to |node|.
+void ApplyYogaProperty(YGNodeRef node, const YogaProperty& property);
+
 void SetYogaProperty(YGNodeRef node, const std::string& key, float value);
 void SetYogaProperty(YGNodeRef node,
                      const std::string& key,
                      const std::string& value);
 
+// Calculate the layout of |node| in LTR direction.
+// Yoga keeps process-wide state when calculating layout (the generation count
+// and the depth of recursion), so calculations of all trees are serialized,
+// including those computed on background threads.
+void CalculateYogaLayout(YGNodeRef node, float width, float height);
+
+// Whether two constraints are equal, NaN means undefined and equals to NaN.
+inline bool ConstraintEquals(float a, float b) {
+  return a == b || (std::isnan(a) && std::isnan(b));
+}
+
 }  // namespace nu
 
 #endif  // NATIVEUI_UTIL_YOGA_UTIL_H_
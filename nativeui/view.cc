@@ -6,7 +6,6 @@
 
 #include <utility>
 
-#include "base/strings/string_util.h"
 #include "nativeui/container.h"
 #include "nativeui/cursor.h"
 #include "nativeui/gfx/font.h"
@@ -26,21 +25,6 @@
 
 namespace nu {
 
-namespace {
-
-// Convert case to lower and remove non-ASCII characters.
-std::string ParseName(const std::string& name) {
-  std::string parsed;
-  parsed.reserve(name.size());
-  for (char c : name) {
-    if (base::IsAsciiAlpha(c))
-      parsed.push_back(base::ToLowerASCII(c));
-  }
-  return parsed;
-}
-
-}  // namespace
-
 // static
 const char View::kClassName[] = "View";
 
@@ -106,7 +90,7 @@ void View::UpdateDefaultStyle() {
 }
 
 void View::SetStyleProperty(const std::string& name, const std::string& value) {
-  std::string key(ParseName(name));
+  std::string key(ParseStyleName(name));
   if (key == "color")
     SetColor(Color(value));
   else if (key == "backgroundcolor")
@@ -116,7 +100,7 @@ void View::SetStyleProperty(const std::string& name, const std::string& value) {
 }
 
 void View::SetStyleProperty(const std::string& name, float value) {
-  SetYogaProperty(node_, ParseName(name), value);
+  SetYogaProperty(node_, ParseStyleName(name), value);
 }
 
 std::string View::GetComputedLayout() const {
@@ -128,10 +112,18 @@ std::string View::GetComputedLayout() const {
   return result;
 }
 
+void View::SetMouseMoveCoalescing(bool coalescing) {
+  mouse_move_coalescing_ = coalescing;
+}
+
 SizeF View::GetMinimumSize() const {
   return SizeF();
 }
 
+SizeF View::MeasureContent(float width, float height) const {
+  return SizeF();
+}
+
 void View::SetParent(View* parent) {
   if (parent) {
     window_ = parent->window_;
@@ -92,6 +92,10 @@ class NATIVEUI_EXPORT View : public base::RefCounted<View> {
   void SetMouseDownCanMoveWindow(bool yes);
   bool IsMouseDownCanMoveWindow() const;
 
+  // Deliver at most one mouse move event per frame.
+  void SetMouseMoveCoalescing(bool coalescing);
+  bool IsMouseMoveCoalescing() const { return mouse_move_coalescing_; }
+
   // Drag and drop.
   int DoDrag(std::vector<Clipboard::Data> data, int operations);
   int DoDragWithOptions(std::vector<Clipboard::Data> data,
@@ -161,6 +165,10 @@ class NATIVEUI_EXPORT View : public base::RefCounted<View> {
   // Internal: Notify that view's size has changed.
   virtual void OnSizeChanged();
 
+  // Internal: Measure the content under the constraints, NaN means undefined.
+  // Only used by views whose CSS nodes have measure functions.
+  virtual SizeF MeasureContent(float width, float height) const;
+
   // Internal: Get the CSS node of the view.
   YGNodeRef node() const { return node_; }
 
@@ -224,6 +232,9 @@ class NATIVEUI_EXPORT View : public base::RefCounted<View> {
 
   // The node recording CSS styles.
   YGNodeRef node_;
+
+  // Whether mouse move events are coalesced.
+  bool mouse_move_coalescing_ = false;
 };
 
 }  // namespace nu
@@ -0,0 +1,62 @@
+// Copyright 2021 Cheng Zhao. All rights reserved.
+// Use of this source code is governed by the license that can be found in the
+// LICENSE file.
+
+#include <vector>
+
+#include "nativeui/nativeui.h"
+#include "nativeui/test/perf_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+class ViewPerfTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    window_ = new nu::Window(nu::Window::Options());
+    window_->SetContentSize(nu::SizeF(800, 600));
+  }
+
+  nu::Lifetime lifetime_;
+  nu::State state_;
+  scoped_refptr<nu::Window> window_;
+};
+
+TEST_F(ViewPerfTest, SetStyle) {
+  for (int views : nu::kPerfTreeSizes) {
+    scoped_refptr<nu::Container> root = new nu::Container;
+    window_->SetContentView(root.get());
+    nu::BuildWideTree(root.get(), views);
+
+    nu::PerfTimer timer;
+    for (int i = 0; i < nu::kPerfMutations; ++i) {
+      root->ChildAt(i)->SetStyle("margin", 2,
+                                 "padding", 4,
+                                 "min-height", 20,
+                                 "flex-direction", "row",
+                                 "align-items", "center",
+                                 "justify-content", "flex-start");
+    }
+    nu::PrintPerfResult("WideTree.SetStyle", views, timer.Elapsed());
+  }
+}
+
+TEST_F(ViewPerfTest, StyleSheet) {
+  scoped_refptr<nu::StyleSheet> sheet = new nu::StyleSheet;
+  sheet->SetStyle("margin", 2,
+                  "padding", 4,
+                  "min-height", 20,
+                  "flex-direction", "row",
+                  "align-items", "center",
+                  "justify-content", "flex-start");
+  for (int views : nu::kPerfTreeSizes) {
+    scoped_refptr<nu::Container> root = new nu::Container;
+    window_->SetContentView(root.get());
+    nu::BuildWideTree(root.get(), views);
+    std::vector<nu::View*> children;
+    for (int i = 0; i < root->ChildCount(); ++i)
+      children.push_back(root->ChildAt(i));
+
+    nu::PerfTimer timer;
+    sheet->ApplyToViews(children);
+    nu::PrintPerfResult("WideTree.StyleSheet", views, timer.Elapsed());
+  }
+}
@@ -22,7 +22,7 @@ class LabelImpl : public ViewImpl {
 
     auto* label = static_cast<Label*>(delegate());
     painter->DrawAttributedText(
-       label->GetAttributedText(), RectF(label->GetBounds().size()));
+       label->GetTextLayout(), RectF(label->GetBounds().size()));
   }
 };
 
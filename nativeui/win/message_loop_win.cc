@@ -27,12 +27,16 @@ void MessageLoop::Quit() {
 
 // static
 void MessageLoop::PostTask(Task task) {
-  PostDelayedTask(USER_TIMER_MINIMUM, std::move(task));
+  State::GetMain()->GetTimerHost()->PostTask(std::move(task));
 }
 
 // static
 void MessageLoop::PostDelayedTask(int ms, Task task) {
-  SetTimeout(ms, std::move(task));
+  // Timers must be set on the UI thread, while this method can be called from
+  // any thread.
+  PostTask([ms, task = std::move(task)]() mutable {
+    SetTimeout(ms, std::move(task));
+  });
 }
 
 // static
@@ -26,6 +26,15 @@ void TimerHost::ClearTimeout(TimerId id) {
   tasks_.erase(id);
 }
 
+void TimerHost::PostTask(Task task) {
+  base::AutoLock auto_lock(lock_);
+  // Unlike SetTimer, PostMessage works from any thread. One message is enough
+  // for all the tasks posted before it is handled.
+  if (posted_tasks_.empty())
+    ::PostMessage(hwnd(), kPostTaskMessage, 0, 0);
+  posted_tasks_.push_back(std::move(task));
+}
+
 void TimerHost::OnTimer(UINT_PTR id) {
   ::KillTimer(hwnd(), id);
   std::function<void()> task;
@@ -40,6 +49,17 @@ void TimerHost::OnTimer(UINT_PTR id) {
   task();
 }
 
+LRESULT TimerHost::OnPostTask(UINT msg, WPARAM w_param, LPARAM l_param) {
+  std::vector<Task> tasks;
+  {
+    base::AutoLock auto_lock(lock_);
+    tasks.swap(posted_tasks_);
+  }
+  for (Task& task : tasks)
+    task();
+  return 0;
+}
+
 UINT_PTR TimerHost::NextTimerId() {
   return static_cast<UINT_PTR>(++next_timer_id_);
 }
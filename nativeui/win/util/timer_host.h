@@ -7,6 +7,7 @@
 
 #include <functional>
 #include <unordered_map>
+#include <vector>
 
 #include "base/synchronization/lock.h"
 #include "nativeui/win/util/win32_window.h"
@@ -21,15 +22,24 @@ class TimerHost : public Win32Window {
   TimerHost();
   ~TimerHost() override;
 
+  // Timers can only be set on the thread that created the host.
   TimerId SetTimeout(int ms, Task task);
   void ClearTimeout(TimerId id);
 
+  // Run |task| on the thread that created the host, can be called on any
+  // thread.
+  void PostTask(Task task);
+
  protected:
+  static const UINT kPostTaskMessage = WM_APP + 1;
+
   CR_BEGIN_MSG_MAP_EX(TimerHost, Win32Window)
     CR_MSG_WM_TIMER(OnTimer)
+    CR_MESSAGE_HANDLER_EX(kPostTaskMessage, OnPostTask)
   CR_END_MSG_MAP()
 
   void OnTimer(UINT_PTR id);
+  LRESULT OnPostTask(UINT msg, WPARAM w_param, LPARAM l_param);
 
  private:
   UINT_PTR NextTimerId();
@@ -39,6 +49,7 @@ class TimerHost : public Win32Window {
 
   base::Lock lock_;
   std::unordered_map<TimerId, Task> tasks_;
+  std::vector<Task> posted_tasks_;
 };
 
 }  // namespace nu
@@ -409,6 +409,7 @@ struct Type<nu::AttributedText> {
         "setColor", &nu::AttributedText::SetColor,
 #if !defined(OS_WIN)
         "setColorFor", &nu::AttributedText::SetColorFor,
+        "setAttributes", &nu::AttributedText::SetAttributes,
 #endif
         "clear", &nu::AttributedText::Clear,
         "getBoundsFor", &nu::AttributedText::GetBoundsFor,
@@ -524,8 +525,7 @@ struct Type<nu::Font> {
   static void BuildConstructor(v8::Local<v8::Context> context,
                                v8::Local<v8::Object> constructor) {
     Set(context, constructor,
-        "create", &CreateOnHeap<nu::Font, const std::string&, float,
-                                nu::Font::Weight, nu::Font::Style>,
+        "create", &Create,
         "createFromPath", &CreateOnHeap<nu::Font, const base::FilePath&, float>,
         "default", &nu::Font::Default);
   }
@@ -538,6 +538,48 @@ struct Type<nu::Font> {
         "getWeight", &nu::Font::GetWeight,
         "getStyle", &nu::Font::GetStyle);
   }
+  // Equal fonts are shared.
+  static nu::Font* Create(const std::string& name, float size,
+                          nu::Font::Weight weight, nu::Font::Style style) {
+    return nu::FontRegistry::GetCurrent()->Get(name, size, weight, style).get();
+  }
+};
+
+template<>
+struct Type<nu::PixelFormat> {
+  static constexpr const char* name = "PixelFormat";
+  static bool FromV8(v8::Local<v8::Context> context,
+                     v8::Local<v8::Value> value,
+                     nu::PixelFormat* out) {
+    std::string format;
+    if (!vb::FromV8(context, value, &format))
+      return false;
+    if (format == "argb32") {
+      *out = nu::PixelFormat::ARGB32;
+      return true;
+    } else if (format == "argb32-premultiplied") {
+      *out = nu::PixelFormat::ARGB32Premultiplied;
+      return true;
+    } else if (format == "rgba") {
+      *out = nu::PixelFormat::RGBA;
+      return true;
+    } else {
+      return false;
+    }
+  }
+  static v8::Local<v8::Value> ToV8(v8::Local<v8::Context> context,
+                                   nu::PixelFormat format) {
+    switch (format) {
+      case nu::PixelFormat::ARGB32:
+        return vb::ToV8(context, "argb32");
+      case nu::PixelFormat::ARGB32Premultiplied:
+        return vb::ToV8(context, "argb32-premultiplied");
+      case nu::PixelFormat::RGBA:
+        return vb::ToV8(context, "rgba");
+    }
+    NOTREACHED();
+    return v8::Undefined(context->GetIsolate());
+  }
 };
 
 template<>
@@ -554,7 +596,74 @@ struct Type<nu::Canvas> {
     Set(context, templ,
         "getScaleFactor", &nu::Canvas::GetScaleFactor,
         "getPainter", &nu::Canvas::GetPainter,
-        "getSize", &nu::Canvas::GetSize);
+        "getSize", &nu::Canvas::GetSize,
+        "lockPixels", &LockPixels,
+        "unlockPixels", &nu::Canvas::UnlockPixels,
+        "isPixelsLocked", &nu::Canvas::IsPixelsLocked);
+  }
+  static v8::Local<v8::Value> LockPixels(Arguments* args) {
+    nu::Canvas* canvas;
+    if (!args->GetHolder(&canvas))
+      return v8::Undefined(args->isolate());
+    nu::Canvas::Pixels pixels = canvas->LockPixels();
+    // Wrap the memory in an external buffer without copying, the buffer keeps
+    // the canvas alive so the memory is never freed before it.
+    canvas->AddRef();
+    v8::Local<v8::Object> data = node::Buffer::New(
+        args->isolate(),
+        static_cast<char*>(pixels.data.content()), pixels.data.size(),
+        [](char* data, void* hint) {
+          static_cast<nu::Canvas*>(hint)->Release();
+        },
+        canvas).ToLocalChecked();
+    v8::Local<v8::Context> context = args->GetContext();
+    v8::Local<v8::Object> obj = v8::Object::New(args->isolate());
+    Set(context, obj,
+        "data", data,
+        "size", pixels.size,
+        "stride", pixels.stride,
+        "format", pixels.format);
+    return obj;
+  }
+};
+
+template<>
+struct Type<nu::Recording> {
+  static constexpr const char* name = "Recording";
+  static void BuildConstructor(v8::Local<v8::Context> context,
+                               v8::Local<v8::Object> constructor) {
+    Set(context, constructor, "create", &CreateOnHeap<nu::Recording>);
+  }
+  static void BuildPrototype(v8::Local<v8::Context> context,
+                             v8::Local<v8::ObjectTemplate> templ) {
+    Set(context, templ,
+        "getPainter", &nu::Recording::GetPainter,
+        "clear", &nu::Recording::Clear,
+        "isEmpty", &nu::Recording::IsEmpty);
+  }
+};
+
+template<>
+struct Type<nu::Path> {
+  static constexpr const char* name = "Path";
+  static void BuildConstructor(v8::Local<v8::Context> context,
+                               v8::Local<v8::Object> constructor) {
+    Set(context, constructor, "create", &CreateOnHeap<nu::Path>);
+  }
+  static void BuildPrototype(v8::Local<v8::Context> context,
+                             v8::Local<v8::ObjectTemplate> templ) {
+    Set(context, templ,
+        "moveTo", &nu::Path::MoveTo,
+        "lineTo", &nu::Path::LineTo,
+        "bezierCurveTo", &nu::Path::BezierCurveTo,
+        "arc", &nu::Path::Arc,
+        "rect", &nu::Path::Rect,
+        "closePath", &nu::Path::ClosePath,
+        "translate", &nu::Path::Translate,
+        "rotate", &nu::Path::Rotate,
+        "scale", &nu::Path::Scale,
+        "clear", &nu::Path::Clear,
+        "isEmpty", &nu::Path::IsEmpty);
   }
 };
 
@@ -887,7 +996,14 @@ struct Type<nu::Image> {
     Set(context, constructor,
         "createEmpty", &CreateOnHeap<nu::Image>,
         "createFromPath", &CreateOnHeap<nu::Image, const base::FilePath&>,
-        "createFromBuffer", &CreateOnHeap<nu::Image, const nu::Buffer&, float>);
+        "createFromBuffer", &CreateOnHeap<nu::Image, const nu::Buffer&, float>,
+        "createThumbnailFromPath",
+        &CreateOnHeap<nu::Image, const base::FilePath&, const nu::SizeF&>,
+        "createFromPixels",
+        &CreateOnHeap<nu::Image, const nu::Buffer&, const nu::Size&, int,
+                      nu::PixelFormat, float>,
+        "createFromPathAsync", &nu::Image::CreateFromPathAsync,
+        "createFromBufferAsync", &nu::Image::CreateFromBufferAsync);
   }
   static void BuildPrototype(v8::Local<v8::Context> context,
                              v8::Local<v8::ObjectTemplate> templ) {
@@ -898,6 +1014,45 @@ struct Type<nu::Image> {
   }
 };
 
+template<>
+struct Type<nu::ImageCache> {
+  static constexpr const char* name = "ImageCache";
+  static void BuildConstructor(v8::Local<v8::Context> context,
+                               v8::Local<v8::Object> constructor) {
+  }
+  static void BuildPrototype(v8::Local<v8::Context> context,
+                             v8::Local<v8::ObjectTemplate> templ) {
+    Set(context, templ,
+        "getFromPath", &nu::ImageCache::GetFromPath,
+        "getThumbnailFromPath", &nu::ImageCache::GetThumbnailFromPath,
+        "getFromBuffer", &nu::ImageCache::GetFromBuffer,
+        "setMemoryBudget", &nu::ImageCache::SetMemoryBudget,
+        "getMemoryBudget", &nu::ImageCache::GetMemoryBudget,
+        "getMemoryUsage", &nu::ImageCache::GetMemoryUsage,
+        "getHitCount", &nu::ImageCache::GetHitCount,
+        "getMissCount", &nu::ImageCache::GetMissCount,
+        "clear", &nu::ImageCache::Clear);
+  }
+};
+
+template<>
+struct Type<nu::TextLayoutCache> {
+  static constexpr const char* name = "TextLayoutCache";
+  static void BuildConstructor(v8::Local<v8::Context> context,
+                               v8::Local<v8::Object> constructor) {
+  }
+  static void BuildPrototype(v8::Local<v8::Context> context,
+                             v8::Local<v8::ObjectTemplate> templ) {
+    Set(context, templ,
+        "setCapacity", &nu::TextLayoutCache::SetCapacity,
+        "getCapacity", &nu::TextLayoutCache::GetCapacity,
+        "getCount", &nu::TextLayoutCache::GetCount,
+        "getHitCount", &nu::TextLayoutCache::GetHitCount,
+        "getMissCount", &nu::TextLayoutCache::GetMissCount,
+        "clear", &nu::TextLayoutCache::Clear);
+  }
+};
+
 template<>
 struct Type<nu::TextAlign> {
   static constexpr const char* name = "TextAlign";
@@ -973,6 +1128,43 @@ struct Type<nu::TextAttributes> {
   }
 };
 
+template<>
+struct Type<nu::AttributedText::Range> {
+  static constexpr const char* name = "AttributedTextRange";
+  static bool FromV8(v8::Local<v8::Context> context,
+                     v8::Local<v8::Value> value,
+                     nu::AttributedText::Range* out) {
+    if (!value->IsObject())
+      return false;
+    v8::Local<v8::Object> obj = value.As<v8::Object>();
+    Get(context, obj, "start", &out->start);
+    Get(context, obj, "end", &out->end);
+    nu::Font* font;
+    if (Get(context, obj, "font", &font))
+      out->font = font;
+    nu::Color color;
+    if (Get(context, obj, "color", &color))
+      out->color = color;
+    return true;
+  }
+};
+
+template<>
+struct Type<nu::TextMeasurer> {
+  static constexpr const char* name = "TextMeasurer";
+  static void BuildConstructor(v8::Local<v8::Context> context,
+                               v8::Local<v8::Object> constructor) {
+    Set(context, constructor,
+        "create", &CreateOnHeap<nu::TextMeasurer, nu::TextAttributes>);
+  }
+  static void BuildPrototype(v8::Local<v8::Context> context,
+                             v8::Local<v8::ObjectTemplate> templ) {
+    Set(context, templ,
+        "measure", &nu::TextMeasurer::Measure,
+        "measureOneLine", &nu::TextMeasurer::MeasureOneLine);
+  }
+};
+
 template<>
 struct Type<nu::Painter> {
   static constexpr const char* name = "Painter";
@@ -1002,15 +1194,49 @@ struct Type<nu::Painter> {
         "setLineWidth", &nu::Painter::SetLineWidth,
         "stroke", &nu::Painter::Stroke,
         "fill", &nu::Painter::Fill,
+        "strokePath", &nu::Painter::StrokePath,
+        "fillPath", &nu::Painter::FillPath,
         "clear", &nu::Painter::Clear,
         "strokeRect", &nu::Painter::StrokeRect,
         "fillRect", &nu::Painter::FillRect,
+        "fillRects", &FillRects,
+        "strokeRects", &StrokeRects,
+        "drawPolyline", &DrawPolyline,
+        "drawPoints", &DrawPoints,
+        "fillCircles", &FillCircles,
         "drawImage", &nu::Painter::DrawImage,
         "drawImageFromRect", &nu::Painter::DrawImageFromRect,
         "drawCanvas", &nu::Painter::DrawCanvas,
         "drawCanvasFromRect", &nu::Painter::DrawCanvasFromRect,
         "drawAttributedText", &nu::Painter::DrawAttributedText,
-        "drawText", &nu::Painter::DrawText);
+        "drawText", &nu::Painter::DrawText,
+        "drawRecording", &nu::Painter::DrawRecording);
+  }
+  static void FillRects(Arguments* args, const nu::Buffer& rects) {
+    nu::Painter* painter;
+    if (args->GetHolder(&painter))
+      painter->FillRects(rects.content(), rects.size());
+  }
+  static void StrokeRects(Arguments* args, const nu::Buffer& rects) {
+    nu::Painter* painter;
+    if (args->GetHolder(&painter))
+      painter->StrokeRects(rects.content(), rects.size());
+  }
+  static void DrawPolyline(Arguments* args, const nu::Buffer& points) {
+    nu::Painter* painter;
+    if (args->GetHolder(&painter))
+      painter->DrawPolyline(points.content(), points.size());
+  }
+  static void DrawPoints(Arguments* args, const nu::Buffer& points,
+                         float size) {
+    nu::Painter* painter;
+    if (args->GetHolder(&painter))
+      painter->DrawPoints(points.content(), points.size(), size);
+  }
+  static void FillCircles(Arguments* args, const nu::Buffer& circles) {
+    nu::Painter* painter;
+    if (args->GetHolder(&painter))
+      painter->FillCircles(circles.content(), circles.size());
   }
 };
 
@@ -1081,7 +1307,8 @@ struct Type<nu::MouseEvent> {
     Set(context, obj,
         "button", event.button,
         "positionInView", event.position_in_view,
-        "positionInWindow", event.position_in_window);
+        "positionInWindow", event.position_in_window,
+        "history", event.history);
     return obj;
   }
 };
@@ -1738,6 +1965,8 @@ struct Type<nu::View> {
         "hasCapture", &nu::View::HasCapture,
         "setMouseDownCanMoveWindow", &nu::View::SetMouseDownCanMoveWindow,
         "isMouseDownCanMoveWindow", &nu::View::IsMouseDownCanMoveWindow,
+        "setMouseMoveCoalescing", &nu::View::SetMouseMoveCoalescing,
+        "isMouseMoveCoalescing", &nu::View::IsMouseMoveCoalescing,
         "doDrag", &nu::View::DoDrag,
         "doDragWithOptions", &nu::View::DoDragWithOptions,
         "cancelDrag", &nu::View::CancelDrag,
@@ -1790,6 +2019,51 @@ struct Type<nu::View> {
   }
 };
 
+template<>
+struct Type<nu::StyleSheet> {
+  static constexpr const char* name = "StyleSheet";
+  static void BuildConstructor(v8::Local<v8::Context> context,
+                               v8::Local<v8::Object> constructor) {
+    Set(context, constructor, "create", &Create);
+  }
+  static void BuildPrototype(v8::Local<v8::Context> context,
+                             v8::Local<v8::ObjectTemplate> templ) {
+    Set(context, templ,
+        "setStyle", &SetStyle,
+        "applyTo", &nu::StyleSheet::ApplyTo,
+        "applyToViews", &nu::StyleSheet::ApplyToViews);
+  }
+  static nu::StyleSheet* Create(
+      v8::Local<v8::Context> context,
+      const std::map<std::string, v8::Local<v8::Value>>& styles) {
+    nu::StyleSheet* sheet = new nu::StyleSheet;
+    SetStyleProperties(context, sheet, styles);
+    return sheet;
+  }
+  static void SetStyle(
+      Arguments* args,
+      v8::Local<v8::Context> context,
+      const std::map<std::string, v8::Local<v8::Value>>& styles) {
+    nu::StyleSheet* sheet;
+    if (!args->GetHolder(&sheet))
+      return;
+    SetStyleProperties(context, sheet, styles);
+  }
+  static void SetStyleProperties(
+      v8::Local<v8::Context> context,
+      nu::StyleSheet* sheet,
+      const std::map<std::string, v8::Local<v8::Value>>& styles) {
+    for (const auto& it : styles) {
+      if (it.second->IsNumber())
+        sheet->SetStyleProperty(
+            it.first, it.second->NumberValue(context).ToChecked());
+      else
+        sheet->SetStyleProperty(
+            it.first, *v8::String::Utf8Value(context->GetIsolate(), it.second));
+    }
+  }
+};
+
 template<>
 struct Type<nu::ComboBox> {
   using base = nu::Picker;
@@ -1831,6 +2105,11 @@ struct Type<nu::Container> {
         RefMethod(&nu::Container::AddChildViewAt, RefType::Ref),
         "removeChildView",
         RefMethod(&nu::Container::RemoveChildView, RefType::Deref),
+        "beginUpdate", &nu::Container::BeginUpdate,
+        "endUpdate", &nu::Container::EndUpdate,
+        "isUpdating", &nu::Container::IsUpdating,
+        "setAsyncLayout", &nu::Container::SetAsyncLayout,
+        "isAsyncLayout", &nu::Container::IsAsyncLayout,
         "childCount", &nu::Container::ChildCount,
         "childAt", &nu::Container::ChildAt);
     SetProperty(context, templ,
@@ -2218,7 +2497,7 @@ struct Type<nu::Label> {
         "setVAlign", &nu::Label::SetVAlign,
         "setAttributedText",
         RefMethod(&nu::Label::SetAttributedText, RefType::Reset, "atext"),
-        "getAttributedText", &nu::Label::GetAttributedText);
+        "getAttributedText", &nu::Label::GetMutableAttributedText);
   }
 };
 
@@ -2766,7 +3045,12 @@ void Initialize(v8::Local<v8::Object> exports,
           "Cursor",            vb::Constructor<nu::Cursor>(),
           "DraggingInfo",      vb::Constructor<nu::DraggingInfo>(),
           "Image",             vb::Constructor<nu::Image>(),
+          "ImageCache",        vb::Constructor<nu::ImageCache>(),
+          "TextLayoutCache",   vb::Constructor<nu::TextLayoutCache>(),
+          "TextMeasurer",      vb::Constructor<nu::TextMeasurer>(),
           "Painter",           vb::Constructor<nu::Painter>(),
+          "Recording",         vb::Constructor<nu::Recording>(),
+          "Path",              vb::Constructor<nu::Path>(),
           "Event",             vb::Constructor<nu::Event>(),
           "FileDialog",        vb::Constructor<nu::FileDialog>(),
           "FileOpenDialog",    vb::Constructor<nu::FileOpenDialog>(),
@@ -2779,6 +3063,7 @@ void Initialize(v8::Local<v8::Object> exports,
           "View",              vb::Constructor<nu::View>(),
           "ComboBox",          vb::Constructor<nu::ComboBox>(),
           "Container",         vb::Constructor<nu::Container>(),
+          "StyleSheet",        vb::Constructor<nu::StyleSheet>(),
           "Button",            vb::Constructor<nu::Button>(),
           "ProtocolStringJob", vb::Constructor<nu::ProtocolStringJob>(),
           "ProtocolFileJob",   vb::Constructor<nu::ProtocolFileJob>(),
@@ -2806,9 +3091,11 @@ void Initialize(v8::Local<v8::Object> exports,
           "Vibrant",           vb::Constructor<nu::Vibrant>(),
 #endif
           // Properties.
-          "app",        nu::App::GetCurrent(),
-          "appearance", nu::Appearance::GetCurrent(),
-          "screen",     nu::Screen::GetCurrent(),
+          "app",             nu::App::GetCurrent(),
+          "appearance",      nu::Appearance::GetCurrent(),
+          "imageCache",      nu::ImageCache::GetCurrent(),
+          "textLayoutCache", nu::TextLayoutCache::GetCurrent(),
+          "screen",          nu::Screen::GetCurrent(),
           // Functions.
           "memoryPressureNotification", &MemoryPressureNotification);
   if (is_electron) {